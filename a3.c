@@ -4,15 +4,160 @@
  * Print usage information
  */
 void print_usage(const char *program_name) {
-    fprintf(stderr, "Usage: %s <algorithm>\n", program_name);
+    fprintf(stderr, "Usage: %s <algorithm> [options]\n", program_name);
     fprintf(stderr, "Algorithms:\n");
     fprintf(stderr, "  FIFO  - First-In-First-Out\n");
     fprintf(stderr, "  OPT   - Optimal\n");
     fprintf(stderr, "  CLK   - Second Chance (Clock)\n");
+    fprintf(stderr, "  WSCLK - Write-back-aware Second Chance (clean-first eviction)\n");
+    fprintf(stderr, "  TIER  - Two-tier memory (fast + slow tier)\n");
+    fprintf(stderr, "\nOptions:\n");
+    fprintf(stderr, "  --window N    - Also save per-window counters every N references\n");
+    fprintf(stderr, "  --no-cache    - Do not read or write the result cache\n");
+    fprintf(stderr, "  --clear-cache - Discard cached results for this trace first\n");
+    fprintf(stderr, "  --trace       - Record faults and evictions to a binary event stream\n");
+    fprintf(stderr, "  --max-faults X      - Find the fewest frames with at most X page faults\n");
+    fprintf(stderr, "  --max-write-backs X - Find the fewest frames with at most X write-backs\n");
+    fprintf(stderr, "  --max-frames F      - Upper bound for the sizing search\n");
+    fprintf(stderr, "  --max-skips N       - Times WSCLK may skip a dirty frame (default %d)\n",
+            WSCLOCK_DEFAULT_SKIPS);
+    fprintf(stderr, "  --fast-policy P     - TIER fast-tier policy, FIFO or CLK (default CLK)\n");
+    fprintf(stderr, "  --slow-policy P     - TIER slow-tier policy, FIFO or CLK (default FIFO)\n");
+    fprintf(stderr, "  --promote K         - TIER register bits needed to promote (default %d)\n",
+            TIER_DEFAULT_PROMOTE);
     fprintf(stderr, "\nExample:\n");
     fprintf(stderr, "  %s FIFO < inputfile.csv\n", program_name);
     fprintf(stderr, "  %s OPT < inputfile.csv\n", program_name);
     fprintf(stderr, "  %s CLK < inputfile.csv\n", program_name);
+    fprintf(stderr, "  %s WSCLK --max-skips 2 < inputfile.csv\n", program_name);
+    fprintf(stderr, "  %s TIER --fast-policy CLK --slow-policy FIFO < inputfile.csv\n", program_name);
+    fprintf(stderr, "  %s FIFO --window 500 < inputfile.csv\n", program_name);
+    fprintf(stderr, "  %s OPT --max-faults 5000 < inputfile.csv\n", program_name);
+    fprintf(stderr, "  %s CLK --trace < inputfile.csv\n", program_name);
+}
+
+/**
+ * Parse an integer option value of at least min_value
+ * Returns the value, or -1 if the string is not a valid integer in range
+ */
+static int parse_int_option(const char *text, int min_value) {
+    char *end;
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || value < min_value || value > 1000000000L) {
+        return -1;
+    }
+    return (int)value;
+}
+
+/**
+ * Parse a tier replacement policy name
+ * Returns 0 on success, -1 if the name is not FIFO or CLK
+ */
+static int parse_tier_policy(const char *text, AlgorithmId *policy) {
+    if (strcmp(text, "FIFO") == 0) {
+        *policy = ALG_FIFO;
+    } else if (strcmp(text, "CLK") == 0) {
+        *policy = ALG_CLK;
+    } else {
+        fprintf(stderr, "Error: Invalid tier policy '%s' (use FIFO or CLK)\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Name of the event stream file for an algorithm, matching its CSV files
+ */
+static const char* event_filename(const char *algorithm) {
+    if (strcmp(algorithm, "FIFO") == 0) {
+        return "fifo_events.bin";
+    } else if (strcmp(algorithm, "OPT") == 0) {
+        return "optimal_events.bin";
+    } else if (strcmp(algorithm, "CLK") == 0) {
+        return "clock_events.bin";
+    } else if (strcmp(algorithm, "WSCLK") == 0) {
+        return "wsclock_events.bin";
+    }
+    return "tiered_events.bin";
+}
+
+/**
+ * Parse optional command-line arguments following the algorithm name
+ * Returns 0 on success, -1 on invalid arguments
+ */
+static int parse_options(int argc, char *argv[], RunOptions *options) {
+    // Defaults
+    options->window = 0;
+    options->use_cache = true;
+    options->clear_cache = false;
+    options->cache = NULL;
+    options->trace_events = false;
+    options->trace = NULL;
+    options->sizing_metric = SIZE_NONE;
+    options->sizing_target = 0;
+    options->max_frames = 0;
+    options->max_skips = WSCLOCK_DEFAULT_SKIPS;
+    options->fast_policy = ALG_CLK;
+    options->slow_policy = ALG_FIFO;
+    options->promote_threshold = TIER_DEFAULT_PROMOTE;
+    
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+            options->window = parse_int_option(argv[++i], 1);
+            if (options->window == -1) {
+                fprintf(stderr, "Error: Invalid window size '%s'\n", argv[i]);
+                return -1;
+            }
+        } else if ((strcmp(argv[i], "--max-faults") == 0 ||
+                    strcmp(argv[i], "--max-write-backs") == 0) && i + 1 < argc) {
+            options->sizing_metric = (strcmp(argv[i], "--max-faults") == 0)
+                                     ? SIZE_FAULTS : SIZE_WRITE_BACKS;
+            options->sizing_target = parse_int_option(argv[++i], 0);
+            if (options->sizing_target == -1) {
+                fprintf(stderr, "Error: Invalid sizing target '%s'\n", argv[i]);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--max-frames") == 0 && i + 1 < argc) {
+            options->max_frames = parse_int_option(argv[++i], 1);
+            if (options->max_frames == -1) {
+                fprintf(stderr, "Error: Invalid frame limit '%s'\n", argv[i]);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--max-skips") == 0 && i + 1 < argc) {
+            options->max_skips = parse_int_option(argv[++i], 0);
+            if (options->max_skips == -1 || options->max_skips > WSCLOCK_MAX_SKIPS) {
+                fprintf(stderr, "Error: Invalid skip count '%s' (0-%d)\n",
+                        argv[i], WSCLOCK_MAX_SKIPS);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--fast-policy") == 0 && i + 1 < argc) {
+            if (parse_tier_policy(argv[++i], &options->fast_policy) != 0) {
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--slow-policy") == 0 && i + 1 < argc) {
+            if (parse_tier_policy(argv[++i], &options->slow_policy) != 0) {
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--promote") == 0 && i + 1 < argc) {
+            options->promote_threshold = parse_int_option(argv[++i], 1);
+            if (options->promote_threshold == -1 || options->promote_threshold > TIER_N_BITS) {
+                fprintf(stderr, "Error: Invalid promotion threshold '%s' (1-%d)\n",
+                        argv[i], TIER_N_BITS);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            options->trace_events = true;
+        } else if (strcmp(argv[i], "--no-cache") == 0) {
+            options->use_cache = false;
+        } else if (strcmp(argv[i], "--clear-cache") == 0) {
+            options->clear_cache = true;
+        } else {
+            fprintf(stderr, "Error: Invalid option '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    
+    return 0;
 }
 
 /**
@@ -20,7 +165,7 @@ void print_usage(const char *program_name) {
  */
 int main(int argc, char *argv[]) {
     // Check command-line arguments
-    if (argc != 2) {
+    if (argc < 2) {
         fprintf(stderr, "Error: Invalid number of arguments\n");
         print_usage(argv[0]);
         return 1;
@@ -32,13 +177,31 @@ int main(int argc, char *argv[]) {
     // Validate algorithm name
     if (strcmp(algorithm, "FIFO") != 0 && 
         strcmp(algorithm, "OPT") != 0 && 
-        strcmp(algorithm, "CLK") != 0) {
+        strcmp(algorithm, "CLK") != 0 &&
+        strcmp(algorithm, "WSCLK") != 0 &&
+        strcmp(algorithm, "TIER") != 0) {
         fprintf(stderr, "Error: Invalid algorithm '%s'\n", algorithm);
-        fprintf(stderr, "Valid algorithms: FIFO, OPT, CLK\n");
+        fprintf(stderr, "Valid algorithms: FIFO, OPT, CLK, WSCLK, TIER\n");
         print_usage(argv[0]);
         return 1;
     }
     
+    // Parse optional arguments
+    RunOptions options;
+    if (parse_options(argc, argv, &options) != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (options.sizing_metric != SIZE_NONE &&
+        (strcmp(algorithm, "WSCLK") == 0 || strcmp(algorithm, "TIER") == 0)) {
+        fprintf(stderr, "Error: Sizing queries support FIFO, OPT and CLK only\n");
+        return 1;
+    }
+    if (options.sizing_metric != SIZE_NONE && (options.window > 0 || options.trace_events)) {
+        fprintf(stderr, "Error: --window and --trace cannot be used with sizing queries\n");
+        return 1;
+    }
+    
     // Read input from stdin
     InputData *data = read_input();
     
@@ -54,17 +217,49 @@ int main(int argc, char *argv[]) {
     // Print input statistics
     fprintf(stderr, "Successfully read %d page references\n", data->count);
     
+    // Open the result cache for this trace
+    if (options.use_cache) {
+        options.cache = cache_open(data, options.clear_cache);
+    }
+    
+    // Open the event stream
+    if (options.trace_events) {
+        options.trace = trace_open(event_filename(algorithm));
+    }
+    
     // Run the appropriate algorithm
-    if (strcmp(algorithm, "FIFO") == 0) {
-        run_fifo_experiments(data);
+    if (options.sizing_metric != SIZE_NONE) {
+        AlgorithmId id = ALG_CLK;
+        if (strcmp(algorithm, "FIFO") == 0) {
+            id = ALG_FIFO;
+        } else if (strcmp(algorithm, "OPT") == 0) {
+            id = ALG_OPT;
+        }
+        run_sizing_query(data, id, &options);
+    }
+    else if (strcmp(algorithm, "FIFO") == 0) {
+        run_fifo_experiments(data, &options);
     } 
     else if (strcmp(algorithm, "OPT") == 0) {
-        run_optimal_experiments(data);
+        run_optimal_experiments(data, &options);
     } 
     else if (strcmp(algorithm, "CLK") == 0) {
-        run_clock_experiments(data);
+        run_clock_experiments(data, &options);
+    }
+    else if (strcmp(algorithm, "WSCLK") == 0) {
+        run_wsclock_experiments(data, &options);
+    }
+    else if (strcmp(algorithm, "TIER") == 0) {
+        run_tiered_experiments(data, &options);
     }
     
+    // Drain and close the event stream
+    trace_close(options.trace);
+    
+    // Report and persist cached results
+    cache_print_stats(options.cache);
+    cache_close(options.cache);
+    
     // Clean up
     free_input(data);
     
@@ -0,0 +1,341 @@
+#define _POSIX_C_SOURCE 200809L  // mkdir(), mkstemp(), fcntl() locks
+
+#include "page_replacement.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define CACHE_MAGIC 0x43523341U  // "A3RC"
+
+// On-disk header preceding the fixed-size CacheEntry records
+typedef struct {
+    uint32_t magic;         // CACHE_MAGIC
+    uint32_t version;       // CACHE_VERSION at the time of writing
+    uint64_t trace_hash;    // Content hash of the trace
+    int32_t count;          // Number of references in the trace
+    int32_t num_entries;    // Number of records following the header
+} CacheHeader;
+
+/**
+ * Compute a 64-bit content hash of the trace (FNV-1a over one word per
+ * reference), so identical traces share cached results
+ */
+uint64_t hash_trace(InputData *data) {
+    uint64_t hash = 14695981039346656037ULL;  // FNV offset basis
+
+    for (int i = 0; i < data->count; i++) {
+        uint32_t word = ((uint32_t)data->references[i].page_number << 1) |
+                        (uint32_t)(data->references[i].dirty & 1);
+        hash ^= word;
+        hash *= 1099511628211ULL;  // FNV prime
+    }
+
+    // Mix in the length so a prefix never collides with the full trace
+    hash ^= (uint64_t)data->count;
+    hash *= 1099511628211ULL;
+
+    return hash;
+}
+
+/**
+ * Grow the entry array if it is full
+ */
+static void cache_reserve(ResultCache *cache, int needed) {
+    if (needed <= cache->capacity) {
+        return;
+    }
+
+    int capacity = cache->capacity > 0 ? cache->capacity : 256;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    CacheEntry *temp = (CacheEntry*)realloc(cache->entries, capacity * sizeof(CacheEntry));
+    if (!temp) {
+        fprintf(stderr, "Error: Memory allocation failed for cache entries\n");
+        exit(1);
+    }
+    cache->entries = temp;
+    cache->capacity = capacity;
+}
+
+/**
+ * Load existing entries from the cache file, ignoring files written by a
+ * different cache version or for a different trace
+ */
+static void cache_load(ResultCache *cache, int num_references) {
+    FILE *fp = fopen(cache->path, "rb");
+    if (!fp) {
+        return;
+    }
+
+    CacheHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        header.magic != CACHE_MAGIC ||
+        header.version != CACHE_VERSION ||
+        header.trace_hash != cache->trace_hash ||
+        header.count != num_references ||
+        header.num_entries < 0) {
+        fprintf(stderr, "Warning: Ignoring stale cache file %s\n", cache->path);
+        fclose(fp);
+        return;
+    }
+
+    cache_reserve(cache, header.num_entries);
+    size_t loaded = fread(cache->entries, sizeof(CacheEntry), header.num_entries, fp);
+    cache->count = (int)loaded;
+    cache->stored_count = (int)loaded;
+
+    fclose(fp);
+}
+
+/**
+ * Take an exclusive lock on the trace's lock file (blocks until granted)
+ * A separate lock file is used because the cache file itself is replaced
+ * by rename(). Returns the lock file descriptor, or -1 if locking failed.
+ */
+static int cache_lock(ResultCache *cache) {
+    char lock_path[520];
+    snprintf(lock_path, sizeof(lock_path), "%s.lock", cache->path);
+
+    int fd = open(lock_path, O_RDWR | O_CREAT, 0644);
+    if (fd == -1) {
+        return -1;
+    }
+
+    struct flock lock;
+    memset(&lock, 0, sizeof(lock));
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+
+    while (fcntl(fd, F_SETLKW, &lock) == -1) {
+        if (errno != EINTR) {
+            close(fd);
+            return -1;
+        }
+    }
+    return fd;
+}
+
+/**
+ * Open the result cache for a trace
+ *
+ * @param data: Loaded trace (hashed to select the cache file)
+ * @param clear: Discard any results cached for this trace
+ * @return Cache handle (always non-NULL; an unwritable directory only
+ *         prevents results from being saved)
+ */
+ResultCache* cache_open(InputData *data, bool clear) {
+    ResultCache *cache = (ResultCache*)malloc(sizeof(ResultCache));
+    if (!cache) {
+        fprintf(stderr, "Error: Memory allocation failed for cache\n");
+        exit(1);
+    }
+
+    cache->trace_hash = hash_trace(data);
+    cache->count_references = data->count;
+    cache->entries = NULL;
+    cache->count = 0;
+    cache->capacity = 0;
+    cache->stored_count = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    snprintf(cache->path, sizeof(cache->path), "%s/%016llx.bin",
+             CACHE_DIR, (unsigned long long)cache->trace_hash);
+
+    // Create results/cache if needed (results/ must exist for that)
+    mkdir("results", 0755);
+    if (mkdir(CACHE_DIR, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Warning: Could not create %s\n", CACHE_DIR);
+    }
+
+    if (clear) {
+        // Hold the lock so a run merging at the same time cannot write the
+        // cleared entries back
+        int lock_fd = cache_lock(cache);
+        if (lock_fd == -1) {
+            fprintf(stderr, "Warning: Could not lock %s; clearing anyway\n", cache->path);
+        }
+        remove(cache->path);
+        if (lock_fd != -1) {
+            close(lock_fd);  // Releases the lock
+        }
+        fprintf(stderr, "Cleared cached results for trace %016llx\n",
+                (unsigned long long)cache->trace_hash);
+    } else {
+        cache_load(cache, data->count);
+    }
+
+    return cache;
+}
+
+/**
+ * Look up a configuration in the cache
+ * Returns true and fills result on a hit; a NULL cache always misses
+ */
+bool cache_lookup(ResultCache *cache, AlgorithmId algorithm, int frames,
+                  int n_bits, int m_interval, Result *result) {
+    if (!cache) {
+        return false;
+    }
+
+    for (int i = 0; i < cache->count; i++) {
+        CacheEntry *entry = &cache->entries[i];
+        if (entry->algorithm == (int32_t)algorithm &&
+            entry->frames == frames &&
+            entry->n_bits == n_bits &&
+            entry->m_interval == m_interval) {
+            result->frames = frames;
+            result->page_faults = entry->page_faults;
+            result->write_backs = entry->write_backs;
+            cache->hits++;
+            return true;
+        }
+    }
+
+    cache->misses++;
+    return false;
+}
+
+/**
+ * Add a freshly simulated result to the cache
+ * New entries are written to disk when the cache is closed
+ */
+void cache_store(ResultCache *cache, AlgorithmId algorithm, int frames,
+                 int n_bits, int m_interval, const Result *result) {
+    if (!cache) {
+        return;
+    }
+
+    // Keep the existing entry (e.g. a run that bypassed the lookup)
+    for (int i = 0; i < cache->count; i++) {
+        CacheEntry *entry = &cache->entries[i];
+        if (entry->algorithm == (int32_t)algorithm &&
+            entry->frames == frames &&
+            entry->n_bits == n_bits &&
+            entry->m_interval == m_interval) {
+            return;
+        }
+    }
+
+    cache_reserve(cache, cache->count + 1);
+    CacheEntry *entry = &cache->entries[cache->count++];
+    entry->algorithm = (int32_t)algorithm;
+    entry->frames = frames;
+    entry->n_bits = n_bits;
+    entry->m_interval = m_interval;
+    entry->page_faults = result->page_faults;
+    entry->write_backs = result->write_backs;
+}
+
+/**
+ * Print cache hit/miss statistics to stderr
+ */
+void cache_print_stats(ResultCache *cache) {
+    if (!cache) {
+        return;
+    }
+
+    int lookups = cache->hits + cache->misses;
+    fprintf(stderr, "Result cache %016llx: %d hits, %d misses (%.1f%% hit rate), %d entries\n",
+            (unsigned long long)cache->trace_hash, cache->hits, cache->misses,
+            lookups > 0 ? 100.0 * cache->hits / lookups : 0.0, cache->count);
+}
+
+/**
+ * Merge entries written by other processes since this cache was opened
+ * The on-disk entries are reloaded, then this run's new entries are added
+ */
+static void cache_merge(ResultCache *cache) {
+    int num_new = cache->count - cache->stored_count;
+    CacheEntry *added = (CacheEntry*)malloc(num_new * sizeof(CacheEntry));
+    if (!added) {
+        fprintf(stderr, "Error: Memory allocation failed for cache entries\n");
+        exit(1);
+    }
+    memcpy(added, cache->entries + cache->stored_count, num_new * sizeof(CacheEntry));
+
+    cache->count = 0;
+    cache->stored_count = 0;
+    cache_load(cache, cache->count_references);
+
+    for (int i = 0; i < num_new; i++) {
+        Result result;
+        result.frames = added[i].frames;
+        result.page_faults = added[i].page_faults;
+        result.write_backs = added[i].write_backs;
+        cache_store(cache, (AlgorithmId)added[i].algorithm, added[i].frames,
+                    added[i].n_bits, added[i].m_interval, &result);
+    }
+
+    free(added);
+}
+
+/**
+ * Write all entries to a per-process temporary file and rename it over
+ * the cache file, so an interrupted run never leaves a truncated cache
+ * Returns true on success
+ */
+static bool cache_write(ResultCache *cache) {
+    char tmp_path[520];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", cache->path);
+
+    int fd = mkstemp(tmp_path);
+    if (fd == -1) {
+        return false;
+    }
+    FILE *fp = fdopen(fd, "wb");
+    if (!fp) {
+        close(fd);
+        remove(tmp_path);
+        return false;
+    }
+
+    CacheHeader header;
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.trace_hash = cache->trace_hash;
+    header.count = cache->count_references;
+    header.num_entries = cache->count;
+
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+              fwrite(cache->entries, sizeof(CacheEntry), cache->count, fp) ==
+                  (size_t)cache->count;
+    ok = (fclose(fp) == 0) && ok;
+
+    if (!ok || rename(tmp_path, cache->path) != 0) {
+        remove(tmp_path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Write new entries to disk and free the cache
+ * Concurrent runs on the same trace are serialized by a lock file; each
+ * merges the entries already on disk with its own before writing, so no
+ * run loses another's results
+ */
+void cache_close(ResultCache *cache) {
+    if (!cache) {
+        return;
+    }
+
+    if (cache->count > cache->stored_count) {
+        int lock_fd = cache_lock(cache);
+        if (lock_fd == -1) {
+            fprintf(stderr, "Warning: Could not lock %s; results not cached\n", cache->path);
+        } else {
+            cache_merge(cache);
+            if (!cache_write(cache)) {
+                fprintf(stderr, "Warning: Could not write %s\n", cache->path);
+            }
+            close(lock_fd);  // Releases the lock
+        }
+    }
+
+    free(cache->entries);
+    free(cache);
+}
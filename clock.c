@@ -7,9 +7,12 @@
  * @param num_frames: Number of page frames available
  * @param n_bits: Number of bits in the reference register (1-32)
  * @param m_interval: Number of references between register shifts
+ * @param series: Optional per-window counters to fill (NULL to disable)
+ * @param trace: Optional event stream for faults and evictions (NULL to disable)
  * @return Result structure with page faults and write-backs
  */
-Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interval) {
+Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interval,
+                      TimeSeries *series, EventTrace *trace) {
     Result result;
     result.frames = num_frames;
     result.page_faults = 0;
@@ -33,6 +36,9 @@ Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interva
         int page = data->references[i].page_number;
         int dirty = data->references[i].dirty;
         
+        // Close the current time-series window if one just ended
+        timeseries_tick(series, i, &result);
+        
         // Check if it's time to shift reference registers
         if (ref_counter >= m_interval) {
             // Shift all reference registers to the right by 1 bit
@@ -99,6 +105,10 @@ Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interva
             }
         }
         
+        // Record the fault and its victim (victim_page is -1 for an empty frame)
+        trace_event(trace, i, page, frames[victim_frame].page_number, victim_frame,
+                    frames[victim_frame].dirty);
+        
         // Load new page into the victim frame
         frames[victim_frame].page_number = page;
         frames[victim_frame].dirty = dirty;
@@ -109,6 +119,9 @@ Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interva
         ref_counter++;
     }
     
+    // Record the final (possibly partial) window
+    timeseries_finish(series, data->count, &result);
+    
     // Free allocated memory
     free(frames);
     
@@ -120,10 +133,19 @@ Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interva
  * Two sets of experiments:
  * 1. Fix m=10, vary n from 1 to 32 with 50 frames
  * 2. Fix n=8, vary m from 1 to 100 with 50 frames
+ * Cached results are reused when a result cache is open
+ * If a time-series window is set, per-window counters are saved as well
+ * If an event stream is open, every run's faults and evictions are traced
  */
-void run_clock_experiments(InputData *data) {
+void run_clock_experiments(InputData *data, RunOptions *options) {
     const int FRAMES = 50;
     
+    // Optional time series, reused across all runs
+    TimeSeries *series = NULL;
+    if (options->window > 0) {
+        series = timeseries_create(options->window, data->count);
+    }
+    
     // Experiment 1: Fix m=10, vary n from 1 to 32
     {
         const int M_FIXED = 10;
@@ -137,6 +159,8 @@ void run_clock_experiments(InputData *data) {
             exit(1);
         }
         
+        FILE *series_fp = series ? timeseries_open_csv("clock_vary_n_timeseries.csv", "n") : NULL;
+        
         // Print table header
         printf("\nCLK, m=%d\n", M_FIXED);
         printf("+----------+----------------+-----------------+\n");
@@ -145,10 +169,26 @@ void run_clock_experiments(InputData *data) {
         
         // Run experiments
         for (int n = MIN_N; n <= MAX_N; n++) {
-            Result result = simulate_clock(data, FRAMES, n, M_FIXED);
+            if (series) {
+                timeseries_reset(series);
+            }
+            
+            // Serve from the cache unless a time series or event trace is needed
+            Result result;
+            if (series || options->trace ||
+                !cache_lookup(options->cache, ALG_CLK, FRAMES, n, M_FIXED, &result)) {
+                trace_begin_run(options->trace, ALG_CLK, FRAMES, n, M_FIXED);
+                result = simulate_clock(data, FRAMES, n, M_FIXED, series, options->trace);
+                cache_store(options->cache, ALG_CLK, FRAMES, n, M_FIXED, &result);
+            }
             result.frames = n;  // Store n value for CSV
             results[n - MIN_N] = result;
             
+            // Flush this run's windows in one go
+            if (series) {
+                timeseries_write_csv(series_fp, n, series);
+            }
+            
             // Print result row
             print_table_row(n, result.page_faults, result.write_backs);
         }
@@ -156,6 +196,9 @@ void run_clock_experiments(InputData *data) {
         // Save results to CSV
         save_results_to_csv("clock_vary_n.csv", results, num_experiments, "n");
         
+        if (series_fp) {
+            fclose(series_fp);
+        }
         free(results);
     }
     
@@ -172,6 +215,8 @@ void run_clock_experiments(InputData *data) {
             exit(1);
         }
         
+        FILE *series_fp = series ? timeseries_open_csv("clock_vary_m_timeseries.csv", "m") : NULL;
+        
         // Print table header
         printf("\nCLK, n=%d\n", N_FIXED);
         printf("+----------+----------------+-----------------+\n");
@@ -180,10 +225,26 @@ void run_clock_experiments(InputData *data) {
         
         // Run experiments
         for (int m = MIN_M; m <= MAX_M; m++) {
-            Result result = simulate_clock(data, FRAMES, N_FIXED, m);
+            if (series) {
+                timeseries_reset(series);
+            }
+            
+            // Serve from the cache unless a time series or event trace is needed
+            Result result;
+            if (series || options->trace ||
+                !cache_lookup(options->cache, ALG_CLK, FRAMES, N_FIXED, m, &result)) {
+                trace_begin_run(options->trace, ALG_CLK, FRAMES, N_FIXED, m);
+                result = simulate_clock(data, FRAMES, N_FIXED, m, series, options->trace);
+                cache_store(options->cache, ALG_CLK, FRAMES, N_FIXED, m, &result);
+            }
             result.frames = m;  // Store m value for CSV
             results[m - MIN_M] = result;
             
+            // Flush this run's windows in one go
+            if (series) {
+                timeseries_write_csv(series_fp, m, series);
+            }
+            
             // Print result row
             print_table_row(m, result.page_faults, result.write_backs);
         }
@@ -191,6 +252,11 @@ void run_clock_experiments(InputData *data) {
         // Save results to CSV
         save_results_to_csv("clock_vary_m.csv", results, num_experiments, "m");
         
+        if (series_fp) {
+            fclose(series_fp);
+        }
         free(results);
     }
+    
+    timeseries_free(series);
 }
\ No newline at end of file
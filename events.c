@@ -0,0 +1,181 @@
+#define _POSIX_C_SOURCE 200809L  // pthreads
+
+#include "page_replacement.h"
+
+#include <pthread.h>
+
+// Ring buffer of event blocks shared by one simulating thread (producer)
+// and the background writer thread (consumer)
+struct TraceWriter {
+    FILE *fp;                   // Output file
+    char path[512];             // Output file path (for messages)
+    TraceEvent *storage;        // Memory for all ring blocks
+    int counts[TRACE_RING_BLOCKS];  // Events in each filled block
+    int head;                   // Block being filled by the producer
+    int tail;                   // Next filled block to write
+    int ready;                  // Filled blocks waiting to be written
+    bool closing;               // Producer has finished
+    bool failed;                // A write failed (later blocks are dropped)
+    long long records;          // Records (events and run markers) handed over
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;   // Signalled when a block is filled
+    pthread_cond_t not_full;    // Signalled when a block is written
+};
+
+/**
+ * Background writer: drain filled blocks to the file, one large
+ * sequential write per block
+ */
+static void* writer_main(void *arg) {
+    TraceWriter *writer = (TraceWriter*)arg;
+
+    pthread_mutex_lock(&writer->lock);
+    while (1) {
+        while (writer->ready == 0 && !writer->closing) {
+            pthread_cond_wait(&writer->not_empty, &writer->lock);
+        }
+        if (writer->ready == 0) {
+            break;  // Closing and fully drained
+        }
+
+        // The producer never touches a filled block, so write it unlocked
+        int idx = writer->tail;
+        int count = writer->counts[idx];
+        pthread_mutex_unlock(&writer->lock);
+
+        TraceEvent *block = writer->storage + (size_t)idx * TRACE_BLOCK_EVENTS;
+        if (!writer->failed &&
+            fwrite(block, sizeof(TraceEvent), count, writer->fp) != (size_t)count) {
+            writer->failed = true;
+        }
+
+        pthread_mutex_lock(&writer->lock);
+        writer->tail = (writer->tail + 1) % TRACE_RING_BLOCKS;
+        writer->ready--;
+        pthread_cond_signal(&writer->not_full);
+    }
+    pthread_mutex_unlock(&writer->lock);
+
+    return NULL;
+}
+
+/**
+ * Open an event stream in results/data and start its writer thread
+ * Returns NULL (with a warning) if the file cannot be created
+ */
+EventTrace* trace_open(const char *filename) {
+    EventTrace *trace = (EventTrace*)malloc(sizeof(EventTrace));
+    TraceWriter *writer = (TraceWriter*)malloc(sizeof(TraceWriter));
+    TraceEvent *storage = (TraceEvent*)malloc((size_t)TRACE_RING_BLOCKS * TRACE_BLOCK_EVENTS *
+                                              sizeof(TraceEvent));
+    if (!trace || !writer || !storage) {
+        fprintf(stderr, "Error: Memory allocation failed for event trace\n");
+        exit(1);
+    }
+
+    snprintf(writer->path, sizeof(writer->path), "results/data/%s", filename);
+    writer->fp = fopen(writer->path, "wb");
+    if (!writer->fp) {
+        fprintf(stderr, "Warning: Could not open %s for writing\n", writer->path);
+        free(storage);
+        free(writer);
+        free(trace);
+        return NULL;
+    }
+
+    TraceHeader header;
+    header.magic = TRACE_MAGIC;
+    header.version = TRACE_VERSION;
+    header.record_size = sizeof(TraceEvent);
+    header.reserved = 0;
+    if (fwrite(&header, sizeof(header), 1, writer->fp) != 1) {
+        fprintf(stderr, "Warning: Could not write event stream header to %s\n", writer->path);
+        fclose(writer->fp);
+        remove(writer->path);
+        free(storage);
+        free(writer);
+        free(trace);
+        return NULL;
+    }
+
+    writer->storage = storage;
+    writer->head = 0;
+    writer->tail = 0;
+    writer->ready = 0;
+    writer->closing = false;
+    writer->failed = false;
+    writer->records = 0;
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->not_empty, NULL);
+    pthread_cond_init(&writer->not_full, NULL);
+
+    if (pthread_create(&writer->thread, NULL, writer_main, writer) != 0) {
+        fprintf(stderr, "Error: Could not start event trace writer thread\n");
+        exit(1);
+    }
+
+    trace->writer = writer;
+    trace->block = storage;
+    trace->fill = 0;
+    return trace;
+}
+
+/**
+ * Hand the current block to the writer and move on to the next free block
+ * Blocks only if the writer has fallen a whole ring behind
+ */
+void trace_flush(EventTrace *trace) {
+    TraceWriter *writer = trace->writer;
+    if (trace->fill == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&writer->lock);
+    writer->counts[writer->head] = trace->fill;
+    writer->records += trace->fill;
+    writer->head = (writer->head + 1) % TRACE_RING_BLOCKS;
+    writer->ready++;
+    pthread_cond_signal(&writer->not_empty);
+
+    // The next block is free once fewer than all blocks are waiting
+    while (writer->ready == TRACE_RING_BLOCKS) {
+        pthread_cond_wait(&writer->not_full, &writer->lock);
+    }
+    pthread_mutex_unlock(&writer->lock);
+
+    trace->block = writer->storage + (size_t)writer->head * TRACE_BLOCK_EVENTS;
+    trace->fill = 0;
+}
+
+/**
+ * Flush remaining events, stop the writer thread and close the file
+ */
+void trace_close(EventTrace *trace) {
+    if (!trace) {
+        return;
+    }
+
+    TraceWriter *writer = trace->writer;
+    trace_flush(trace);
+
+    pthread_mutex_lock(&writer->lock);
+    writer->closing = true;
+    pthread_cond_signal(&writer->not_empty);
+    pthread_mutex_unlock(&writer->lock);
+    pthread_join(writer->thread, NULL);
+
+    if (fclose(writer->fp) != 0 || writer->failed) {
+        fprintf(stderr, "Warning: Could not write all events to %s\n", writer->path);
+    } else {
+        fprintf(stderr, "Event trace: %lld records written to %s\n",
+                writer->records, writer->path);
+    }
+
+    pthread_mutex_destroy(&writer->lock);
+    pthread_cond_destroy(&writer->not_empty);
+    pthread_cond_destroy(&writer->not_full);
+    free(writer->storage);
+    free(writer);
+    free(trace);
+}
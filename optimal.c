@@ -48,9 +48,12 @@ static int find_optimal_victim(Frame *frames, int num_frames, InputData *data, i
  * 
  * @param data: Input data containing page references
  * @param num_frames: Number of page frames available
+ * @param series: Optional per-window counters to fill (NULL to disable)
+ * @param trace: Optional event stream for faults and evictions (NULL to disable)
  * @return Result structure with page faults and write-backs
  */
-Result simulate_optimal(InputData *data, int num_frames) {
+Result simulate_optimal(InputData *data, int num_frames, TimeSeries *series,
+                        EventTrace *trace) {
     Result result;
     result.frames = num_frames;
     result.page_faults = 0;
@@ -71,6 +74,9 @@ Result simulate_optimal(InputData *data, int num_frames) {
         int page = data->references[i].page_number;
         int dirty = data->references[i].dirty;
         
+        // Close the current time-series window if one just ended
+        timeseries_tick(series, i, &result);
+        
         // Check if page is already in frames (page hit)
         int frame_idx = find_page_in_frames(frames, num_frames, page);
         
@@ -101,11 +107,18 @@ Result simulate_optimal(InputData *data, int num_frames) {
             }
         }
         
+        // Record the fault and its victim (victim_page is -1 for an empty frame)
+        trace_event(trace, i, page, frames[victim_frame].page_number, victim_frame,
+                    frames[victim_frame].dirty);
+        
         // Load new page into the victim frame
         frames[victim_frame].page_number = page;
         frames[victim_frame].dirty = dirty;
     }
     
+    // Record the final (possibly partial) window
+    timeseries_finish(series, data->count, &result);
+    
     // Free allocated memory
     free(frames);
     
@@ -115,8 +128,11 @@ Result simulate_optimal(InputData *data, int num_frames) {
 /**
  * Run Optimal experiments for frames 1 to 100
  * Print results and save to CSV
+ * Cached results are reused when a result cache is open
+ * If a time-series window is set, per-window counters are saved as well
+ * If an event stream is open, every run's faults and evictions are traced
  */
-void run_optimal_experiments(InputData *data) {
+void run_optimal_experiments(InputData *data, RunOptions *options) {
     const int MIN_FRAMES = 1;
     const int MAX_FRAMES = 100;
     int num_experiments = MAX_FRAMES - MIN_FRAMES + 1;
@@ -128,14 +144,38 @@ void run_optimal_experiments(InputData *data) {
         exit(1);
     }
     
+    // Optional time series, reused across frame counts
+    TimeSeries *series = NULL;
+    FILE *series_fp = NULL;
+    if (options->window > 0) {
+        series = timeseries_create(options->window, data->count);
+        series_fp = timeseries_open_csv("optimal_timeseries.csv", "Frames");
+    }
+    
     // Print table header
     print_table_header("OPT");
     
     // Run simulation for each frame count
     for (int frames = MIN_FRAMES; frames <= MAX_FRAMES; frames++) {
-        Result result = simulate_optimal(data, frames);
+        if (series) {
+            timeseries_reset(series);
+        }
+        
+        // Serve from the cache unless a time series or event trace is needed
+        Result result;
+        if (series || options->trace ||
+            !cache_lookup(options->cache, ALG_OPT, frames, 0, 0, &result)) {
+            trace_begin_run(options->trace, ALG_OPT, frames, 0, 0);
+            result = simulate_optimal(data, frames, series, options->trace);
+            cache_store(options->cache, ALG_OPT, frames, 0, 0, &result);
+        }
         results[frames - MIN_FRAMES] = result;
         
+        // Flush this run's windows in one go
+        if (series) {
+            timeseries_write_csv(series_fp, frames, series);
+        }
+        
         // Print result row
         print_table_row(frames, result.page_faults, result.write_backs);
     }
@@ -143,6 +183,11 @@ void run_optimal_experiments(InputData *data) {
     // Save results to CSV for plotting
     save_results_to_csv("optimal_results.csv", results, num_experiments, "Frames");
     
+    if (series_fp) {
+        fclose(series_fp);
+    }
+    timeseries_free(series);
+    
     // Free results array
     free(results);
 }
\ No newline at end of file
@@ -11,6 +11,19 @@
 #define MAX_PAGES 500           // Maximum number of different pages (0-499)
 #define MAX_REFERENCES 20000    // Maximum number of page references
 #define MAX_LINE_LENGTH 256     // Maximum length of input line
+#define WSCLOCK_DEFAULT_SKIPS 2 // Default times a dirty frame may be skipped
+#define WSCLOCK_MAX_SKIPS 32    // Largest accepted --max-skips
+#define TIER_N_BITS 8           // Reference register bits used by the two-tier mode
+#define TIER_M_INTERVAL 10      // Shift interval used by the two-tier mode
+#define TIER_DEFAULT_PROMOTE 2  // Default register bits set to promote a slow page
+#define TRACE_BLOCK_EVENTS 8192 // Events per ring-buffer block (one write each)
+#define TRACE_RING_BLOCKS 8     // Blocks in the event ring buffer
+#define TRACE_RUN_MARKER (-1)   // ref_index of the record that starts a run
+#define TRACE_RUN_OPTIONS (-2)  // ref_index of a run's engine-specific settings
+#define TRACE_MAGIC 0x56453341U // "A3EV" - event stream file signature
+#define TRACE_VERSION 3         // Bump when TraceEvent changes
+#define CACHE_DIR "results/cache"   // Location of the persistent result cache
+#define CACHE_VERSION 1         // Bump when simulation behaviour changes
 
 // Page reference structure
 typedef struct {
@@ -34,31 +47,244 @@ typedef struct {
     int write_backs;    // Total write-backs
 } Result;
 
+// Result structure for write-back-aware Second Chance
+typedef struct {
+    int frames;                 // Number of frames used (or swept parameter)
+    int page_faults;            // Total page faults
+    int sync_write_backs;       // Dirty victims written back on the fault path
+    int background_write_backs; // Dirty pages cleaned asynchronously
+    int extra_faults;           // Page faults beyond plain CLK with the same n, m
+} WSClockResult;
+
+// Result structure for two-tier memory simulation
+typedef struct {
+    int fast_frames;    // Number of fast-tier frames
+    int slow_frames;    // Number of slow-tier frames
+    int fast_hits;      // References served by the fast tier
+    int slow_hits;      // References served by the slow tier
+    int promotions;     // Pages moved from the slow to the fast tier
+    int demotions;      // Fast-tier victims moved to the slow tier
+    int page_faults;    // References found in neither tier
+    int write_backs;    // Dirty pages evicted from memory
+} TieredResult;
+
 // Input data structure
 typedef struct {
     PageReference *references;  // Array of page references
     int count;                   // Number of references
 } InputData;
 
+// Per-window counters collected during a single simulation pass
+// Counters are stored cumulatively at each window boundary; per-window
+// values are derived when the series is written out
+typedef struct {
+    int window;         // Number of references per window
+    int capacity;       // Number of window slots allocated
+    int count;          // Number of windows recorded so far
+    int next_boundary;  // Reference index that closes the current window
+    int *end_refs;      // References processed at the end of each window
+    int *faults;        // Page faults at the end of each window
+    int *write_backs;   // Write-backs at the end of each window
+} TimeSeries;
+
+// Algorithm identifiers (stored on disk by the result cache - do not renumber)
+typedef enum {
+    ALG_FIFO = 1,
+    ALG_OPT = 2,
+    ALG_CLK = 3,
+    ALG_WSCLK = 4,
+    ALG_TIER = 5
+} AlgorithmId;
+
+// One cached simulation result (fixed-size on-disk record)
+typedef struct {
+    int32_t algorithm;      // AlgorithmId
+    int32_t frames;         // Number of frames
+    int32_t n_bits;         // Reference register bits (0 if unused)
+    int32_t m_interval;     // Shift interval (0 if unused)
+    int32_t page_faults;    // Total page faults
+    int32_t write_backs;    // Total write-backs
+} CacheEntry;
+
+// Persistent result cache for one trace, keyed by its content hash
+typedef struct {
+    uint64_t trace_hash;    // Content hash of the loaded trace
+    char path[512];         // Cache file for this trace
+    int count_references;   // Number of references in the trace
+    CacheEntry *entries;    // Loaded and newly added entries
+    int count;              // Number of entries
+    int capacity;           // Allocated entry slots
+    int stored_count;       // Entries already present on disk
+    int hits;               // Lookups served from the cache
+    int misses;             // Lookups that required a simulation
+} ResultCache;
+
+// Metric bounded by a sizing query
+typedef enum {
+    SIZE_NONE = 0,      // No sizing query (run the normal sweeps)
+    SIZE_FAULTS,        // Bound total page faults
+    SIZE_WRITE_BACKS    // Bound total write-backs
+} SizingMetric;
+
+// Fixed-size event record written to the binary event stream (12 bytes)
+// Pages, frames and run parameters all fit in 16 bits (pages < MAX_PAGES)
+// A run marker (ref_index == TRACE_RUN_MARKER) precedes each run's events and
+// holds page = AlgorithmId, victim_page = frames, victim_frame = n_bits,
+// dirty = m_interval (for TIER: fast frames, slow frames, promote threshold)
+// An options record (ref_index == TRACE_RUN_OPTIONS) may follow the marker
+// with settings the marker cannot hold: page = max_skips for WSCLK, and
+// page = fast policy, victim_page = slow policy (AlgorithmId) for TIER
+typedef struct {
+    int32_t ref_index;      // Index of the faulting reference
+    int16_t page;           // Faulting page
+    int16_t victim_page;    // Page evicted from memory (-1 if none)
+    int16_t victim_frame;   // Frame the faulting page displaced or filled
+    int16_t dirty;          // 1 if the victim was dirty (written back)
+} TraceEvent;
+
+// Header at the start of an event stream file, followed by TraceEvent records
+typedef struct {
+    uint32_t magic;         // TRACE_MAGIC
+    uint32_t version;       // TRACE_VERSION
+    uint32_t record_size;   // sizeof(TraceEvent)
+    uint32_t reserved;      // Always 0
+} TraceHeader;
+
+// Background writer draining the ring buffer (defined in events.c)
+typedef struct TraceWriter TraceWriter;
+
+// Event stream of one simulating thread
+typedef struct {
+    TraceEvent *block;      // Ring-buffer block being filled
+    int fill;               // Events in the current block
+    TraceWriter *writer;    // Background writer thread and ring buffer
+} EventTrace;
+
+// Options shared by the experiment drivers
+typedef struct {
+    int window;         // References per time-series window (0 = disabled)
+    SizingMetric sizing_metric;  // Metric for a sizing query (SIZE_NONE = sweep)
+    int sizing_target;  // Largest acceptable value of the sizing metric
+    int max_frames;     // Largest frame count a sizing query may return
+    int max_skips;      // Times WSCLK may skip a dirty frame before evicting it
+    AlgorithmId fast_policy;     // Fast-tier replacement policy (ALG_FIFO or ALG_CLK)
+    AlgorithmId slow_policy;     // Slow-tier replacement policy (ALG_FIFO or ALG_CLK)
+    int promote_threshold;       // Register bits set to promote a slow-tier page
+    bool use_cache;     // Serve and store results in the persistent cache
+    bool clear_cache;   // Discard this trace's cached results before running
+    ResultCache *cache; // Open cache (NULL when disabled)
+    bool trace_events;  // Record faults and evictions to a binary event stream
+    EventTrace *trace;  // Open event stream (NULL when disabled)
+} RunOptions;
+
 // Function prototypes - Utils
 InputData* read_input(void);
 void free_input(InputData *data);
+int count_distinct_pages(InputData *data);
 void print_table_header(const char *algorithm_name);
 void print_table_row(int param, int page_faults, int write_backs);
 void print_table_footer(void);
 void save_results_to_csv(const char *filename, Result *results, int count, const char *param_name);
 
+// Function prototypes - Time series
+TimeSeries* timeseries_create(int window, int num_references);
+void timeseries_reset(TimeSeries *series);
+void timeseries_record(TimeSeries *series, int ref_index, const Result *result);
+void timeseries_finish(TimeSeries *series, int num_references, const Result *result);
+void timeseries_free(TimeSeries *series);
+FILE* timeseries_open_csv(const char *filename, const char *param_name);
+void timeseries_write_csv(FILE *fp, int param, const TimeSeries *series);
+void timeseries_write_csv_pair(FILE *fp, int param1, int param2, const TimeSeries *series);
+
+/**
+ * Close the current window if reference ref_index starts a new one
+ * Called once per reference, so the common path is a single compare
+ */
+static inline void timeseries_tick(TimeSeries *series, int ref_index, const Result *result) {
+    if (series && ref_index == series->next_boundary) {
+        timeseries_record(series, ref_index, result);
+    }
+}
+
+// Function prototypes - Event tracing
+EventTrace* trace_open(const char *filename);
+void trace_flush(EventTrace *trace);
+void trace_close(EventTrace *trace);
+
+/**
+ * Append one event to the trace (no-op when trace is NULL)
+ * Only copies into the current block; full blocks are handed to the
+ * background writer
+ */
+static inline void trace_event(EventTrace *trace, int ref_index, int page,
+                               int victim_page, int victim_frame, int dirty) {
+    if (trace) {
+        TraceEvent *event = &trace->block[trace->fill];
+        event->ref_index = ref_index;
+        event->page = (int16_t)page;
+        event->victim_page = (int16_t)victim_page;
+        event->victim_frame = (int16_t)victim_frame;
+        event->dirty = (int16_t)dirty;
+        if (++trace->fill == TRACE_BLOCK_EVENTS) {
+            trace_flush(trace);
+        }
+    }
+}
+
+/**
+ * Mark the start of a run in the trace (no-op when trace is NULL)
+ */
+static inline void trace_begin_run(EventTrace *trace, AlgorithmId algorithm,
+                                   int frames, int n_bits, int m_interval) {
+    trace_event(trace, TRACE_RUN_MARKER, (int)algorithm, frames, n_bits, m_interval);
+}
+
+/**
+ * Record engine-specific settings of the run just begun (no-op when trace
+ * is NULL)
+ */
+static inline void trace_run_options(EventTrace *trace, int option1, int option2) {
+    trace_event(trace, TRACE_RUN_OPTIONS, option1, option2, 0, 0);
+}
+
+// Function prototypes - Result cache
+uint64_t hash_trace(InputData *data);
+ResultCache* cache_open(InputData *data, bool clear);
+bool cache_lookup(ResultCache *cache, AlgorithmId algorithm, int frames,
+                  int n_bits, int m_interval, Result *result);
+void cache_store(ResultCache *cache, AlgorithmId algorithm, int frames,
+                 int n_bits, int m_interval, const Result *result);
+void cache_print_stats(ResultCache *cache);
+void cache_close(ResultCache *cache);
+
+// Function prototypes - Sizing queries
+void run_sizing_query(InputData *data, AlgorithmId algorithm, RunOptions *options);
+
 // Function prototypes - FIFO Algorithm
-Result simulate_fifo(InputData *data, int num_frames);
-void run_fifo_experiments(InputData *data);
+Result simulate_fifo(InputData *data, int num_frames, TimeSeries *series,
+                     EventTrace *trace);
+void run_fifo_experiments(InputData *data, RunOptions *options);
 
 // Function prototypes - Optimal Algorithm
-Result simulate_optimal(InputData *data, int num_frames);
-void run_optimal_experiments(InputData *data);
+Result simulate_optimal(InputData *data, int num_frames, TimeSeries *series,
+                        EventTrace *trace);
+void run_optimal_experiments(InputData *data, RunOptions *options);
 
 // Function prototypes - Second Chance (Clock) Algorithm
-Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interval);
-void run_clock_experiments(InputData *data);
+Result simulate_clock(InputData *data, int num_frames, int n_bits, int m_interval,
+                      TimeSeries *series, EventTrace *trace);
+void run_clock_experiments(InputData *data, RunOptions *options);
+
+// Function prototypes - Write-back-aware Second Chance (WSClock)
+WSClockResult simulate_wsclock(InputData *data, int num_frames, int n_bits, int m_interval,
+                               int max_skips, TimeSeries *series, EventTrace *trace);
+void run_wsclock_experiments(InputData *data, RunOptions *options);
+
+// Function prototypes - Two-tier memory
+TieredResult simulate_tiered(InputData *data, int fast_frames, int slow_frames,
+                             AlgorithmId fast_policy, AlgorithmId slow_policy,
+                             int promote_threshold, TimeSeries *series, EventTrace *trace);
+void run_tiered_experiments(InputData *data, RunOptions *options);
 
 // Helper functions
 int find_page_in_frames(Frame *frames, int num_frames, int page_number);
@@ -0,0 +1,232 @@
+#include "page_replacement.h"
+
+#define SIZING_VERIFY_RADIUS 8  // Smaller sizes re-checked by the verified search
+#define SIZING_CLK_N 8          // Reference register bits used for CLK queries
+#define SIZING_CLK_M 10         // Shift interval used for CLK queries
+
+// State of one sizing query
+typedef struct {
+    InputData *data;
+    AlgorithmId algorithm;
+    RunOptions *options;
+    int limit;          // Largest frame count that may be reported
+    Result *results;    // Memoized results indexed by frame count
+    bool *known;        // Whether results[frames] has been evaluated
+    int simulated;      // Sizes that had to be simulated
+    int cached;         // Sizes served from the result cache
+    int verified;       // Sizes checked below a boundary by the verified search
+} SizingSearch;
+
+/**
+ * Get the result for a frame count, simulating it only if it is neither
+ * memoized nor in the result cache
+ */
+static Result evaluate(SizingSearch *search, int frames) {
+    if (search->known[frames]) {
+        return search->results[frames];
+    }
+
+    int n_bits = (search->algorithm == ALG_CLK) ? SIZING_CLK_N : 0;
+    int m_interval = (search->algorithm == ALG_CLK) ? SIZING_CLK_M : 0;
+
+    Result result;
+    if (cache_lookup(search->options->cache, search->algorithm, frames,
+                     n_bits, m_interval, &result)) {
+        search->cached++;
+    } else {
+        switch (search->algorithm) {
+            case ALG_FIFO:
+                result = simulate_fifo(search->data, frames, NULL, NULL);
+                break;
+            case ALG_OPT:
+                result = simulate_optimal(search->data, frames, NULL, NULL);
+                break;
+            case ALG_CLK:
+            default:
+                result = simulate_clock(search->data, frames, n_bits, m_interval, NULL, NULL);
+                break;
+        }
+        cache_store(search->options->cache, search->algorithm, frames,
+                    n_bits, m_interval, &result);
+        search->simulated++;
+    }
+
+    search->results[frames] = result;
+    search->known[frames] = true;
+    return result;
+}
+
+/**
+ * Check whether a frame count keeps the queried metric within the target
+ */
+static bool within_target(SizingSearch *search, int frames) {
+    Result result = evaluate(search, frames);
+    int value = (search->options->sizing_metric == SIZE_FAULTS)
+                ? result.page_faults : result.write_backs;
+    return value <= search->options->sizing_target;
+}
+
+/**
+ * Gallop up from 1 frame, then binary search, for the smallest frame count
+ * in [1, hi] that meets the target
+ * Exact when the metric is monotone in the frame count; otherwise it returns
+ * a size that meets the target while the size just below it does not
+ *
+ * @param hi: Frame count already known to meet the target
+ */
+static int search_boundary(SizingSearch *search, int hi) {
+    int lo = 0;  // Largest size known to miss the target (0 = none)
+    int probe = 1;
+
+    // Gallop: double the size until it meets the target
+    while (probe < hi && !within_target(search, probe)) {
+        lo = probe;
+        probe *= 2;
+    }
+    if (probe > hi) {
+        probe = hi;
+    }
+
+    // Binary search between the last miss and the first hit
+    while (probe - lo > 1) {
+        int mid = lo + (probe - lo) / 2;
+        if (within_target(search, mid)) {
+            probe = mid;
+        } else {
+            lo = mid;
+        }
+    }
+
+    return probe;
+}
+
+/**
+ * Check the SIZING_VERIFY_RADIUS sizes below a boundary and restart the
+ * search below any of them that also meets the target
+ *
+ * @param best: Boundary to verify (need not meet the target itself)
+ * @return Smallest size found this way, or best if none below it qualifies
+ */
+static int verify_boundary(SizingSearch *search, int best) {
+    bool restarted = true;
+    while (restarted) {
+        restarted = false;
+        for (int k = 1; k <= SIZING_VERIFY_RADIUS && best - k >= 1; k++) {
+            search->verified++;
+            if (within_target(search, best - k)) {
+                best = search_boundary(search, best - k);
+                restarted = true;
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * OPT is a stack algorithm, so its fault count never increases with more
+ * frames. Write-backs carry no such guarantee, and FIFO (Belady's anomaly)
+ * and CLK are not stack algorithms.
+ */
+static bool is_monotone(AlgorithmId algorithm, SizingMetric metric) {
+    return algorithm == ALG_OPT && metric == SIZE_FAULTS;
+}
+
+/**
+ * Answer "what is the smallest frame count that keeps page faults (or
+ * write-backs) at or below the target" without a full sweep
+ *
+ * Monotone engines use a galloping binary search (O(log F) simulations).
+ * Other engines use a verified search: after each boundary is found, the
+ * SIZING_VERIFY_RADIUS sizes below it are checked, and the search restarts
+ * below any of them that also meets the target.
+ *
+ * Frame counts above the number of distinct pages never evict a page, so
+ * the search range is capped there regardless of --max-frames. Other
+ * engines search all the way to that cap, where faults are at their minimum
+ * and nothing is written back: a size at --max-frames may miss the target
+ * while a smaller one meets it, so the limit alone cannot rule sizes out.
+ */
+void run_sizing_query(InputData *data, AlgorithmId algorithm, RunOptions *options) {
+    const char *names[] = { "", "FIFO", "OPT", "CLK" };
+    const char *metric_name = (options->sizing_metric == SIZE_FAULTS)
+                              ? "page faults" : "write-backs";
+
+    int distinct = count_distinct_pages(data);
+    int limit = distinct;
+    if (options->max_frames > 0 && options->max_frames < limit) {
+        limit = options->max_frames;
+    }
+
+    bool monotone = is_monotone(algorithm, options->sizing_metric);
+    int upper = monotone ? limit : distinct;
+
+    SizingSearch search;
+    search.data = data;
+    search.algorithm = algorithm;
+    search.options = options;
+    search.limit = limit;
+    search.simulated = 0;
+    search.cached = 0;
+    search.verified = 0;
+    search.results = (Result*)malloc((upper + 1) * sizeof(Result));
+    search.known = (bool*)calloc(upper + 1, sizeof(bool));
+    if (!search.results || !search.known) {
+        fprintf(stderr, "Error: Memory allocation failed for sizing query\n");
+        exit(1);
+    }
+
+    int best = -1;
+
+    if (within_target(&search, upper)) {
+        best = search_boundary(&search, upper);
+
+        if (!monotone) {
+            // Look for smaller sizes that also meet the target
+            best = verify_boundary(&search, best);
+
+            // A boundary beyond --max-frames may still have qualifying sizes
+            // just below the limit
+            if (best > limit) {
+                best = verify_boundary(&search, limit + 1);
+            }
+        }
+
+        if (best > limit) {
+            best = -1;
+        }
+    }
+
+    // Print every evaluated size in frame order
+    char title[128];
+    snprintf(title, sizeof(title), "%s, %s <= %d", names[algorithm],
+             metric_name, options->sizing_target);
+    print_table_header(title);
+    for (int frames = 1; frames <= upper; frames++) {
+        if (search.known[frames]) {
+            print_table_row(frames, search.results[frames].page_faults,
+                            search.results[frames].write_backs);
+        }
+    }
+
+    if (best == -1) {
+        printf("No frame count up to %d keeps %s <= %d\n",
+               limit, metric_name, options->sizing_target);
+        if (limit == distinct) {
+            printf("(the trace has %d distinct pages; more frames never help)\n", distinct);
+        }
+    } else {
+        printf("Smallest frame count: %d\n", best);
+    }
+
+    if (monotone) {
+        printf("Search: binary (monotone), ");
+    } else {
+        printf("Search: verified (%d smaller sizes checked), ", search.verified);
+    }
+    printf("%d sizes simulated, %d from cache, range 1-%d\n",
+           search.simulated, search.cached, upper);
+
+    free(search.results);
+    free(search.known);
+}
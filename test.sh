@@ -181,12 +181,167 @@ if [ ! -z "$fifo_50" ] && [ ! -z "$opt_50" ]; then
 fi
 echo ""
 
+# WSCLK without skipping must behave exactly like CLK
+echo "=========================================="
+echo "Step 9: WSCLK with --max-skips 0 vs Clock"
+echo "=========================================="
+./a3 WSCLK --max-skips 0 --no-cache < Assignment_3_input_file.csv > results/wsclock_output.txt 2>&1
+for param in n m; do
+    # WSCLK columns: param,PageFaults,SyncWriteBack,BackgroundWriteBack,ExtraFaults
+    if diff <(tail -n +2 "results/data/clock_vary_$param.csv") \
+            <(tail -n +2 "results/data/wsclock_vary_$param.csv" | cut -d, -f1-3) > /dev/null &&
+       ! tail -n +2 "results/data/wsclock_vary_$param.csv" | cut -d, -f4-5 | grep -qv '^0,0$'; then
+        echo "  ✓ wsclock_vary_$param.csv matches clock_vary_$param.csv"
+    else
+        echo "  ✗ wsclock_vary_$param.csv differs from clock_vary_$param.csv!"
+    fi
+done
+echo ""
+
+# Per-window counts must add up to the sweep totals
+echo "=========================================="
+echo "Step 10: Time series (--window)"
+echo "=========================================="
+ref_count=$(( $(wc -l < Assignment_3_input_file.csv) - 1 ))
+# Pick a window that does not divide the trace, so the last window is partial
+window=997
+if [ $(( ref_count % window )) -eq 0 ]; then
+    window=1009
+fi
+./a3 FIFO --window $window --no-cache < Assignment_3_input_file.csv > results/fifo_window_output.txt 2>&1
+mismatches=$(awk -F, 'NR == FNR { if (FNR > 1) { faults[$1] += $4; write_backs[$1] += $5 } next }
+                     FNR > 1 && (faults[$1] != $2 || write_backs[$1] != $3) { bad++ }
+                     END { print bad + 0 }' \
+             results/data/fifo_timeseries.csv results/data/fifo_results.csv)
+if [ "$mismatches" -eq 0 ]; then
+    echo "  ✓ fifo_timeseries.csv windows sum to fifo_results.csv for every frame count"
+else
+    echo "  ✗ fifo_timeseries.csv windows differ from fifo_results.csv in $mismatches rows!"
+fi
+last_end=$(tail -1 results/data/fifo_timeseries.csv | cut -d, -f3)
+if [ "$last_end" = "$ref_count" ]; then
+    echo "  ✓ Last window (size $window) ends at reference $ref_count"
+else
+    echo "  ✗ Last window ends at '$last_end', expected $ref_count"
+fi
+echo ""
+
+# A repeated sweep on the same trace must be served entirely from the cache
+echo "=========================================="
+echo "Step 11: Result cache"
+echo "=========================================="
+make clean-cache > /dev/null
+./a3 FIFO < Assignment_3_input_file.csv > /dev/null 2>&1
+cache_line=$(./a3 FIFO < Assignment_3_input_file.csv 2>&1 > /dev/null | grep "Result cache")
+echo "  $cache_line"
+if echo "$cache_line" | grep -q "(100.0% hit rate)"; then
+    echo "  ✓ Second FIFO run served from the cache"
+else
+    echo "  ✗ Second FIFO run was not fully cached!"
+fi
+clear_line=$(./a3 FIFO --clear-cache < Assignment_3_input_file.csv 2>&1 > /dev/null | grep "Result cache")
+if echo "$clear_line" | grep -q " 0 hits,"; then
+    echo "  ✓ --clear-cache discarded the cached results"
+else
+    echo "  ✗ --clear-cache still served cached results: $clear_line"
+fi
+echo ""
+
+# A sizing query must return the first sweep row meeting the target
+echo "=========================================="
+echo "Step 12: Sizing queries vs sweeps"
+echo "=========================================="
+for alg in FIFO OPT; do
+    if [ "$alg" = "FIFO" ]; then csv="results/data/fifo_results.csv"; else csv="results/data/optimal_results.csv"; fi
+    # Just below the 50-frame result, so the answer is not simply 50
+    target=$(( $(awk -F, '$1 == 50 {print $2}' "$csv") - 1 ))
+    expected=$(awk -F, -v t="$target" 'FNR > 1 && $2 <= t {print $1; exit}' "$csv")
+    answer=$(./a3 $alg --max-faults "$target" < Assignment_3_input_file.csv 2>/dev/null |
+             awk '/Smallest frame count:/ {print $4}')
+    if [ -n "$answer" ] && [ "$answer" = "$expected" ]; then
+        echo "  ✓ $alg --max-faults $target: $answer frames (matches sweep)"
+    else
+        echo "  ✗ $alg --max-faults $target: got '$answer', sweep says '$expected'"
+    fi
+done
+
+# Write-backs are not monotone: when the --max-frames size itself misses the
+# target, smaller sizes must still be considered. Use the first size whose
+# write-backs rise over the size below it if the sweep has one.
+for alg in FIFO OPT; do
+    if [ "$alg" = "FIFO" ]; then csv="results/data/fifo_results.csv"; else csv="results/data/optimal_results.csv"; fi
+    read -r max_frames target <<< "$(awk -F, 'FNR > 2 && $3 > prev { print $1, prev; found = 1; exit }
+                                             { prev = $3 }
+                                             END { if (!found) print 60, "" }' "$csv")"
+    if [ -z "$target" ]; then
+        target=$(awk -F, '$1 == 50 {print $3}' "$csv")
+    fi
+    expected=$(awk -F, -v t="$target" -v f="$max_frames" 'FNR > 1 && $1 <= f && $3 <= t {print $1; exit}' "$csv")
+    answer=$(./a3 $alg --max-write-backs "$target" --max-frames "$max_frames" < Assignment_3_input_file.csv 2>/dev/null |
+             awk '/Smallest frame count:/ {print $4}')
+    if [ -n "$answer" ] && [ "$answer" = "$expected" ]; then
+        echo "  ✓ $alg --max-write-backs $target --max-frames $max_frames: $answer frames (matches sweep)"
+    else
+        echo "  ✗ $alg --max-write-backs $target --max-frames $max_frames: got '$answer', sweep says '$expected'"
+    fi
+done
+echo ""
+
+# A slow tier of 0 frames leaves only the fast tier's policy
+echo "=========================================="
+echo "Step 13: TIER with no slow tier vs FIFO/Clock"
+echo "=========================================="
+# Default fast policy is CLK (n=8, m=10): compare with clock_vary_n.csv at 50 frames
+./a3 TIER --no-cache < Assignment_3_input_file.csv > results/tiered_output.txt 2>&1
+tier_clk=$(awk -F, '$1 == 50 && $2 == 0 {print $7 "," $8}' results/data/tiered_results.csv)
+clk_n8=$(awk -F, '$1 == 8 {print $2 "," $3}' results/data/clock_vary_n.csv)
+if [ -n "$tier_clk" ] && [ "$tier_clk" = "$clk_n8" ]; then
+    echo "  ✓ TIER (CLK, 50 fast, 0 slow) matches CLK n=8 ($tier_clk)"
+else
+    echo "  ✗ TIER (CLK, 50 fast, 0 slow) = '$tier_clk', CLK n=8 = '$clk_n8'"
+fi
+
+./a3 TIER --fast-policy FIFO --no-cache < Assignment_3_input_file.csv > results/tiered_fifo_output.txt 2>&1
+mismatches=$(awk -F, 'NR == FNR { if (FNR > 1) fifo[$1] = $2 "," $3; next }
+                     FNR > 1 && $2 == 0 && fifo[$1] != $7 "," $8 { bad++ }
+                     END { print bad + 0 }' \
+             results/data/fifo_results.csv results/data/tiered_results.csv)
+if [ "$mismatches" -eq 0 ]; then
+    echo "  ✓ TIER (FIFO, 0 slow) matches FIFO at every fast-tier size"
+else
+    echo "  ✗ TIER (FIFO, 0 slow) differs from FIFO in $mismatches rows!"
+fi
+echo ""
+
+# The decoder must find one run per swept configuration
+echo "=========================================="
+echo "Step 14: Event trace decoding"
+echo "=========================================="
+./a3 CLK --trace < Assignment_3_input_file.csv > /dev/null 2>&1
+expected_runs=$(( $(wc -l < results/data/clock_vary_n.csv) + $(wc -l < results/data/clock_vary_m.csv) - 2 ))
+decode_line=$(./trace2csv results/data/clock_events.bin 2>&1 > results/clock_events.csv)
+echo "  $decode_line"
+if echo "$decode_line" | grep -q "in $expected_runs runs$"; then
+    echo "  ✓ clock_events.bin decoded with $expected_runs runs"
+else
+    echo "  ✗ Expected $expected_runs runs in clock_events.bin!"
+fi
+./a3 WSCLK --max-skips 3 --trace < Assignment_3_input_file.csv > /dev/null 2>&1
+other_skips=$(./trace2csv results/data/wsclock_events.bin 2>/dev/null | awk -F, 'NR > 1 && $6 != 3' | wc -l)
+if [ "$other_skips" -eq 0 ]; then
+    echo "  ✓ wsclock_events.bin records --max-skips 3 on every row"
+else
+    echo "  ✗ $other_skips rows of wsclock_events.bin lack --max-skips 3!"
+fi
+echo ""
+
 # Summary
 echo "=========================================="
 echo "Test Summary"
 echo "=========================================="
 echo "✓ Compilation successful"
 echo "✓ All three algorithms executed"
+echo "✓ Feature checks run (see Step 9 onward)"
 echo "✓ Output tables generated"
 echo "✓ CSV files created for plotting"
 echo ""
@@ -0,0 +1,403 @@
+#include "page_replacement.h"
+
+// One frame pool of the two-tier memory
+typedef struct {
+    Frame *frames;          // Frames of this tier (NULL if it has none)
+    int num_frames;         // Number of frames
+    AlgorithmId policy;     // ALG_FIFO or ALG_CLK
+    int clock_hand;         // Clock hand position (CLK)
+    int time;               // Arrival counter for load_time (FIFO)
+} Tier;
+
+// Page that left memory when a fast-tier victim was demoted
+typedef struct {
+    int page;           // Evicted page (-1 if nothing left memory)
+    int frame;          // Frame it left, numbering slow frames after fast ones
+    int dirty;          // 1 if it was written back
+} Eviction;
+
+/**
+ * Allocate and initialize a tier
+ */
+static void tier_init(Tier *tier, int num_frames, AlgorithmId policy) {
+    tier->num_frames = num_frames;
+    tier->policy = policy;
+    tier->clock_hand = 0;
+    tier->time = 0;
+    tier->frames = NULL;
+
+    if (num_frames > 0) {
+        tier->frames = (Frame*)malloc(num_frames * sizeof(Frame));
+        if (!tier->frames) {
+            fprintf(stderr, "Error: Memory allocation failed for frames\n");
+            exit(1);
+        }
+        initialize_frames(tier->frames, num_frames);
+    }
+}
+
+/**
+ * Shift the reference registers of all occupied frames right by 1 bit
+ */
+static void tier_shift(Tier *tier) {
+    for (int j = 0; j < tier->num_frames; j++) {
+        if (tier->frames[j].page_number != -1) {
+            tier->frames[j].ref_bits >>= 1;
+        }
+    }
+}
+
+/**
+ * Choose the frame a new page goes into: an empty frame if there is one,
+ * otherwise the victim chosen by the tier's policy (same rules as
+ * simulate_fifo and simulate_clock)
+ */
+static int tier_choose_frame(Tier *tier) {
+    Frame *frames = tier->frames;
+    int num_frames = tier->num_frames;
+
+    int victim_frame = find_empty_frame(frames, num_frames);
+    if (victim_frame != -1) {
+        if (tier->policy == ALG_CLK && victim_frame == tier->clock_hand) {
+            tier->clock_hand = (tier->clock_hand + 1) % num_frames;
+        }
+        return victim_frame;
+    }
+
+    if (tier->policy == ALG_FIFO) {
+        // Oldest arrival
+        victim_frame = 0;
+        for (int j = 1; j < num_frames; j++) {
+            if (frames[j].load_time < frames[victim_frame].load_time) {
+                victim_frame = j;
+            }
+        }
+        return victim_frame;
+    }
+
+    // Second chance scan
+    while (frames[tier->clock_hand].ref_bits != 0) {
+        frames[tier->clock_hand].ref_bits >>= 1;
+        tier->clock_hand = (tier->clock_hand + 1) % num_frames;
+    }
+    victim_frame = tier->clock_hand;
+    tier->clock_hand = (tier->clock_hand + 1) % num_frames;
+    return victim_frame;
+}
+
+/**
+ * Put a page into a frame of the tier, keeping its dirty bit and history
+ */
+static void tier_place(Tier *tier, int frame_idx, int page, int dirty, uint32_t ref_bits) {
+    Frame *frame = &tier->frames[frame_idx];
+    frame->page_number = page;
+    frame->dirty = dirty;
+    frame->ref_bits = ref_bits;
+    frame->load_time = tier->time++;
+}
+
+/**
+ * Move a page evicted from the fast tier into the slow tier
+ * If the slow tier is full its victim leaves memory (write-back if dirty);
+ * without a slow tier the page itself leaves memory
+ *
+ * @param page_frame: Copy of the fast-tier frame being demoted
+ * @param fast_slot: Fast-tier frame the page is leaving
+ * @param fast_frames: Number of fast-tier frames
+ * @return The page that left memory, if any
+ */
+static Eviction demote(Tier *slow, Frame *page_frame, int fast_slot, int fast_frames,
+                       TieredResult *result) {
+    Eviction eviction;
+    eviction.page = -1;
+    eviction.frame = fast_slot;
+    eviction.dirty = 0;
+
+    if (slow->num_frames == 0) {
+        // No slow tier: the page leaves memory
+        if (page_frame->dirty) {
+            result->write_backs++;
+        }
+        eviction.page = page_frame->page_number;
+        eviction.dirty = page_frame->dirty;
+        return eviction;
+    }
+
+    result->demotions++;
+
+    int slot = tier_choose_frame(slow);
+    Frame *victim = &slow->frames[slot];
+    if (victim->page_number != -1) {
+        if (victim->dirty) {
+            result->write_backs++;
+        }
+        eviction.page = victim->page_number;
+        eviction.frame = fast_frames + slot;
+        eviction.dirty = victim->dirty;
+    }
+    tier_place(slow, slot, page_frame->page_number, page_frame->dirty, page_frame->ref_bits);
+
+    return eviction;
+}
+
+/**
+ * Count set bits of a reference register
+ */
+static int count_bits(uint32_t bits) {
+    int count = 0;
+    while (bits) {
+        bits &= bits - 1;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Simulate a two-tier memory: a small fast tier in front of a larger slow tier
+ *
+ * New pages are loaded into the fast tier. Fast-tier victims are demoted to
+ * the slow tier instead of being evicted; only slow-tier victims leave memory.
+ * A page hit in the slow tier is promoted once its n-bit reference register
+ * (shifted every m references, as in Second Chance) has at least
+ * promote_threshold bits set, swapping places with the fast tier's victim.
+ *
+ * @param data: Input data containing page references
+ * @param fast_frames: Number of fast-tier frames (at least 1)
+ * @param slow_frames: Number of slow-tier frames (0 = single tier)
+ * @param fast_policy: Replacement policy of the fast tier (ALG_FIFO or ALG_CLK)
+ * @param slow_policy: Replacement policy of the slow tier (ALG_FIFO or ALG_CLK)
+ * @param promote_threshold: Register bits needed to promote a slow-tier page
+ * @param series: Optional per-window counters to fill (NULL to disable);
+ *                faults and write-backs are the ones that leave memory
+ * @param trace: Optional event stream for faults and evictions (NULL to disable);
+ *               victim frames number slow-tier frames after the fast ones
+ * @return TieredResult with per-tier hits, migrations, faults and write-backs
+ */
+TieredResult simulate_tiered(InputData *data, int fast_frames, int slow_frames,
+                             AlgorithmId fast_policy, AlgorithmId slow_policy,
+                             int promote_threshold, TimeSeries *series, EventTrace *trace) {
+    const int n_bits = TIER_N_BITS;
+    const int m_interval = TIER_M_INTERVAL;
+    const uint32_t referenced = 1U << (n_bits - 1);
+
+    TieredResult result;
+    result.fast_frames = fast_frames;
+    result.slow_frames = slow_frames;
+    result.fast_hits = 0;
+    result.slow_hits = 0;
+    result.promotions = 0;
+    result.demotions = 0;
+    result.page_faults = 0;
+    result.write_backs = 0;
+
+    Tier fast, slow;
+    tier_init(&fast, fast_frames, fast_policy);
+    tier_init(&slow, slow_frames, slow_policy);
+
+    int ref_counter = 0;  // Counter for reference register shifts
+
+    // Running totals in the form the time series expects
+    Result progress;
+    progress.frames = fast_frames;
+    progress.page_faults = 0;
+    progress.write_backs = 0;
+
+    // Process each page reference
+    for (int i = 0; i < data->count; i++) {
+        int page = data->references[i].page_number;
+        int dirty = data->references[i].dirty;
+
+        // Close the current time-series window if one just ended
+        progress.page_faults = result.page_faults;
+        progress.write_backs = result.write_backs;
+        timeseries_tick(series, i, &progress);
+
+        // Check if it's time to shift reference registers (both tiers)
+        if (ref_counter >= m_interval) {
+            tier_shift(&fast);
+            tier_shift(&slow);
+            ref_counter = 0;
+        }
+        ref_counter++;
+
+        // Fast-tier hit
+        int frame_idx = find_page_in_frames(fast.frames, fast.num_frames, page);
+        if (frame_idx != -1) {
+            result.fast_hits++;
+            fast.frames[frame_idx].ref_bits |= referenced;
+            if (dirty) {
+                fast.frames[frame_idx].dirty = 1;
+            }
+            continue;
+        }
+
+        // Slow-tier hit, promoted if it has been hot recently
+        frame_idx = find_page_in_frames(slow.frames, slow.num_frames, page);
+        if (frame_idx != -1) {
+            result.slow_hits++;
+            Frame *hit = &slow.frames[frame_idx];
+            hit->ref_bits |= referenced;
+            if (dirty) {
+                hit->dirty = 1;
+            }
+
+            if (count_bits(hit->ref_bits) >= promote_threshold) {
+                Frame promoted = *hit;
+                hit->page_number = -1;  // Free the slot for the demoted page
+                hit->dirty = 0;
+                hit->ref_bits = 0;
+
+                int slot = tier_choose_frame(&fast);
+                if (fast.frames[slot].page_number != -1) {
+                    Frame demoted = fast.frames[slot];
+                    demote(&slow, &demoted, slot, fast_frames, &result);
+                }
+                tier_place(&fast, slot, promoted.page_number, promoted.dirty, promoted.ref_bits);
+                result.promotions++;
+            }
+            continue;
+        }
+
+        // Page fault - page is in neither tier
+        result.page_faults++;
+
+        int slot = tier_choose_frame(&fast);
+        Eviction eviction = { -1, slot, 0 };
+        if (fast.frames[slot].page_number != -1) {
+            Frame demoted = fast.frames[slot];
+            eviction = demote(&slow, &demoted, slot, fast_frames, &result);
+        }
+        tier_place(&fast, slot, page, dirty, referenced);
+
+        // Record the fault and the page that left memory (if any)
+        trace_event(trace, i, page, eviction.page, eviction.frame, eviction.dirty);
+    }
+
+    // Record the final (possibly partial) window
+    progress.page_faults = result.page_faults;
+    progress.write_backs = result.write_backs;
+    timeseries_finish(series, data->count, &progress);
+
+    // Free allocated memory
+    free(fast.frames);
+    free(slow.frames);
+
+    return result;
+}
+
+/**
+ * Print table header for two-tier experiments
+ */
+static void print_tiered_header(const char *title) {
+    printf("\n%s\n", title);
+    printf("+--------+--------+-----------+-----------+------------+------------+-------------+-------------+\n");
+    printf("| %-6s | %-6s | %-9s | %-9s | %-10s | %-10s | %-11s | %-11s |\n",
+           "Fast", "Slow", "Fast Hits", "Slow Hits", "Promotions", "Demotions",
+           "Page Faults", "Write-backs");
+    printf("+--------+--------+-----------+-----------+------------+------------+-------------+-------------+\n");
+}
+
+/**
+ * Print a single row in the two-tier table
+ */
+static void print_tiered_row(const TieredResult *result) {
+    printf("| %-6d | %-6d | %-9d | %-9d | %-10d | %-10d | %-11d | %-11d |\n",
+           result->fast_frames, result->slow_frames, result->fast_hits, result->slow_hits,
+           result->promotions, result->demotions, result->page_faults, result->write_backs);
+    printf("+--------+--------+-----------+-----------+------------+------------+-------------+-------------+\n");
+}
+
+/**
+ * Save two-tier results to CSV file for plotting
+ */
+static void save_tiered_results_to_csv(const char *filename, TieredResult *results, int count) {
+    char filepath[512];
+    snprintf(filepath, sizeof(filepath), "results/data/%s", filename);
+
+    FILE *fp = fopen(filepath, "w");
+    if (!fp) {
+        fprintf(stderr, "Warning: Could not open %s for writing\n", filepath);
+        return;
+    }
+
+    fprintf(fp, "FastFrames,SlowFrames,FastHits,SlowHits,Promotions,Demotions,PageFaults,WriteBack\n");
+    for (int i = 0; i < count; i++) {
+        fprintf(fp, "%d,%d,%d,%d,%d,%d,%d,%d\n",
+                results[i].fast_frames, results[i].slow_frames,
+                results[i].fast_hits, results[i].slow_hits,
+                results[i].promotions, results[i].demotions,
+                results[i].page_faults, results[i].write_backs);
+    }
+
+    fclose(fp);
+}
+
+/**
+ * Run two-tier experiments over both tier sizes
+ * Fast tier: 5 to 50 frames in steps of 5
+ * Slow tier: 0 to 100 frames in steps of 10 (0 = fast tier only)
+ * If a time-series window is set, per-window counters are saved as well
+ */
+void run_tiered_experiments(InputData *data, RunOptions *options) {
+    const int MIN_FAST = 5;
+    const int MAX_FAST = 50;
+    const int STEP_FAST = 5;
+    const int MIN_SLOW = 0;
+    const int MAX_SLOW = 100;
+    const int STEP_SLOW = 10;
+    int num_experiments = ((MAX_FAST - MIN_FAST) / STEP_FAST + 1) *
+                          ((MAX_SLOW - MIN_SLOW) / STEP_SLOW + 1);
+
+    TieredResult *results = (TieredResult*)malloc(num_experiments * sizeof(TieredResult));
+    if (!results) {
+        fprintf(stderr, "Error: Memory allocation failed for results\n");
+        exit(1);
+    }
+
+    char title[128];
+    snprintf(title, sizeof(title), "TIER, fast=%s, slow=%s, n=%d, m=%d, promote>=%d",
+             options->fast_policy == ALG_FIFO ? "FIFO" : "CLK",
+             options->slow_policy == ALG_FIFO ? "FIFO" : "CLK",
+             TIER_N_BITS, TIER_M_INTERVAL, options->promote_threshold);
+    print_tiered_header(title);
+
+    // Optional time series, reused across all runs
+    TimeSeries *series = NULL;
+    FILE *series_fp = NULL;
+    if (options->window > 0) {
+        series = timeseries_create(options->window, data->count);
+        series_fp = timeseries_open_csv("tiered_timeseries.csv", "FastFrames,SlowFrames");
+    }
+
+    int count = 0;
+    for (int fast = MIN_FAST; fast <= MAX_FAST; fast += STEP_FAST) {
+        for (int slow = MIN_SLOW; slow <= MAX_SLOW; slow += STEP_SLOW) {
+            if (series) {
+                timeseries_reset(series);
+            }
+            trace_begin_run(options->trace, ALG_TIER, fast, slow, options->promote_threshold);
+            trace_run_options(options->trace, options->fast_policy, options->slow_policy);
+            TieredResult result = simulate_tiered(data, fast, slow,
+                                                  options->fast_policy, options->slow_policy,
+                                                  options->promote_threshold, series,
+                                                  options->trace);
+
+            // Flush this run's windows in one go
+            if (series) {
+                timeseries_write_csv_pair(series_fp, fast, slow, series);
+            }
+
+            results[count++] = result;
+            print_tiered_row(&result);
+        }
+    }
+
+    save_tiered_results_to_csv("tiered_results.csv", results, count);
+
+    if (series_fp) {
+        fclose(series_fp);
+    }
+    timeseries_free(series);
+
+    free(results);
+}
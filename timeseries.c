@@ -0,0 +1,160 @@
+#include "page_replacement.h"
+
+/**
+ * Allocate a time series large enough for a whole trace
+ * All window slots are allocated up front so recording never allocates
+ *
+ * @param window: Number of references per window
+ * @param num_references: Number of references in the trace
+ * @return Newly allocated time series
+ */
+TimeSeries* timeseries_create(int window, int num_references) {
+    TimeSeries *series = (TimeSeries*)malloc(sizeof(TimeSeries));
+    if (!series) {
+        fprintf(stderr, "Error: Memory allocation failed for time series\n");
+        exit(1);
+    }
+
+    series->window = window;
+    series->capacity = (num_references + window - 1) / window;
+    if (series->capacity < 1) {
+        series->capacity = 1;
+    }
+
+    series->end_refs = (int*)malloc(series->capacity * sizeof(int));
+    series->faults = (int*)malloc(series->capacity * sizeof(int));
+    series->write_backs = (int*)malloc(series->capacity * sizeof(int));
+    if (!series->end_refs || !series->faults || !series->write_backs) {
+        fprintf(stderr, "Error: Memory allocation failed for time series windows\n");
+        exit(1);
+    }
+
+    timeseries_reset(series);
+    return series;
+}
+
+/**
+ * Clear recorded windows so the series can be reused for another run
+ */
+void timeseries_reset(TimeSeries *series) {
+    series->count = 0;
+    series->next_boundary = series->window;
+}
+
+/**
+ * Record cumulative counters at the end of a window
+ *
+ * @param ref_index: Number of references processed so far
+ * @param result: Running totals of the simulation
+ */
+void timeseries_record(TimeSeries *series, int ref_index, const Result *result) {
+    if (series->count >= series->capacity) {
+        return;
+    }
+
+    series->end_refs[series->count] = ref_index;
+    series->faults[series->count] = result->page_faults;
+    series->write_backs[series->count] = result->write_backs;
+    series->count++;
+    series->next_boundary += series->window;
+}
+
+/**
+ * Record the trailing partial window (if any) after the last reference
+ */
+void timeseries_finish(TimeSeries *series, int num_references, const Result *result) {
+    if (!series) {
+        return;
+    }
+
+    int last_end = (series->count > 0) ? series->end_refs[series->count - 1] : 0;
+    if (num_references > last_end) {
+        timeseries_record(series, num_references, result);
+    }
+}
+
+/**
+ * Free memory allocated for a time series
+ */
+void timeseries_free(TimeSeries *series) {
+    if (series) {
+        free(series->end_refs);
+        free(series->faults);
+        free(series->write_backs);
+        free(series);
+    }
+}
+
+/**
+ * Open a time-series CSV file next to the other result files
+ * Returns NULL (with a warning) if the file cannot be created
+ */
+FILE* timeseries_open_csv(const char *filename, const char *param_name) {
+    char filepath[512];
+    snprintf(filepath, sizeof(filepath), "results/data/%s", filename);
+
+    FILE *fp = fopen(filepath, "w");
+    if (!fp) {
+        fprintf(stderr, "Warning: Could not open %s for writing\n", filepath);
+        return NULL;
+    }
+
+    // Write header
+    fprintf(fp, "%s,Window,EndReference,PageFaults,WriteBack,HitRatio\n", param_name);
+    return fp;
+}
+
+/**
+ * Write the windows of one run, converting cumulative counters to
+ * per-window values
+ *
+ * @param params: Already formatted parameter column(s) identifying the run
+ */
+static void write_windows(FILE *fp, const char *params, const TimeSeries *series) {
+    int prev_refs = 0;
+    int prev_faults = 0;
+    int prev_write_backs = 0;
+
+    for (int i = 0; i < series->count; i++) {
+        int refs = series->end_refs[i] - prev_refs;
+        int faults = series->faults[i] - prev_faults;
+        int write_backs = series->write_backs[i] - prev_write_backs;
+        double hit_ratio = (refs > 0) ? (double)(refs - faults) / refs : 0.0;
+
+        fprintf(fp, "%s,%d,%d,%d,%d,%.4f\n",
+                params, i, series->end_refs[i], faults, write_backs, hit_ratio);
+
+        prev_refs = series->end_refs[i];
+        prev_faults = series->faults[i];
+        prev_write_backs = series->write_backs[i];
+    }
+}
+
+/**
+ * Write the windows of one run identified by a single parameter
+ *
+ * @param param: Experiment parameter (frames, n or m) identifying the run
+ */
+void timeseries_write_csv(FILE *fp, int param, const TimeSeries *series) {
+    if (!fp) {
+        return;
+    }
+
+    char params[16];
+    snprintf(params, sizeof(params), "%d", param);
+    write_windows(fp, params, series);
+}
+
+/**
+ * Write the windows of one run identified by two parameters
+ * (e.g. fast and slow tier sizes)
+ */
+void timeseries_write_csv_pair(FILE *fp, int param1, int param2, const TimeSeries *series) {
+    if (!fp) {
+        return;
+    }
+
+    char params[32];
+    snprintf(params, sizeof(params), "%d,%d", param1, param2);
+    write_windows(fp, params, series);
+}
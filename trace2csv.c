@@ -0,0 +1,115 @@
+#include "page_replacement.h"
+
+#define DECODE_CHUNK 8192  // Records read per fread
+
+/**
+ * Name of an algorithm id stored in a run marker
+ */
+static const char* algorithm_name(int algorithm) {
+    switch (algorithm) {
+        case ALG_FIFO:  return "FIFO";
+        case ALG_OPT:   return "OPT";
+        case ALG_CLK:   return "CLK";
+        case ALG_WSCLK: return "WSCLK";
+        case ALG_TIER:  return "TIER";
+        default:        return "UNKNOWN";
+    }
+}
+
+/**
+ * Decoder for the binary event streams written with --trace
+ * Converts a file of TraceEvent records to CSV on stdout, one row per event,
+ * each tagged with the configuration of the run it belongs to
+ * (for TIER runs, Frames/N/M hold fast frames, slow frames and the
+ * promotion threshold). Settings that do not apply to a run's algorithm
+ * are left empty.
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <events.bin>\n", argv[0]);
+        fprintf(stderr, "\nExample:\n");
+        fprintf(stderr, "  %s results/data/clock_events.bin > clock_events.csv\n", argv[0]);
+        return 1;
+    }
+
+    FILE *fp = fopen(argv[1], "rb");
+    if (!fp) {
+        fprintf(stderr, "Error: Could not open %s\n", argv[1]);
+        return 1;
+    }
+
+    TraceHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        header.magic != TRACE_MAGIC ||
+        header.version != TRACE_VERSION ||
+        header.record_size != sizeof(TraceEvent)) {
+        fprintf(stderr, "Error: %s is not a version %d event stream\n", argv[1], TRACE_VERSION);
+        fclose(fp);
+        return 1;
+    }
+
+    TraceEvent *events = (TraceEvent*)malloc(DECODE_CHUNK * sizeof(TraceEvent));
+    if (!events) {
+        fprintf(stderr, "Error: Memory allocation failed for events\n");
+        fclose(fp);
+        return 1;
+    }
+
+    // Configuration of the current run
+    int run = -1;
+    int algorithm = 0;
+    int frames = 0;
+    int n_bits = 0;
+    int m_interval = 0;
+    char max_skips[16] = "";    // WSCLK only (empty for other algorithms)
+    int fast_policy = 0;        // TIER only (0 for other algorithms)
+    int slow_policy = 0;        // TIER only (0 for other algorithms)
+    long long count = 0;
+
+    printf("Run,Algorithm,Frames,N,M,MaxSkips,FastPolicy,SlowPolicy,"
+           "Reference,Page,VictimPage,VictimFrame,Dirty\n");
+
+    size_t read;
+    while ((read = fread(events, sizeof(TraceEvent), DECODE_CHUNK, fp)) > 0) {
+        for (size_t i = 0; i < read; i++) {
+            TraceEvent *event = &events[i];
+
+            if (event->ref_index == TRACE_RUN_MARKER) {
+                run++;
+                algorithm = event->page;
+                frames = event->victim_page;
+                n_bits = event->victim_frame;
+                m_interval = event->dirty;
+                max_skips[0] = '\0';
+                fast_policy = 0;
+                slow_policy = 0;
+                continue;
+            }
+
+            if (event->ref_index == TRACE_RUN_OPTIONS) {
+                if (algorithm == ALG_WSCLK) {
+                    snprintf(max_skips, sizeof(max_skips), "%d", event->page);
+                } else if (algorithm == ALG_TIER) {
+                    fast_policy = event->page;
+                    slow_policy = event->victim_page;
+                }
+                continue;
+            }
+
+            printf("%d,%s,%d,%d,%d,%s,%s,%s,%d,%d,%d,%d,%d\n",
+                   run, algorithm_name(algorithm), frames, n_bits, m_interval,
+                   max_skips,
+                   fast_policy ? algorithm_name(fast_policy) : "",
+                   slow_policy ? algorithm_name(slow_policy) : "",
+                   event->ref_index, event->page, event->victim_page,
+                   event->victim_frame, event->dirty);
+            count++;
+        }
+    }
+
+    fprintf(stderr, "Decoded %lld events in %d runs\n", count, run + 1);
+
+    free(events);
+    fclose(fp);
+    return 0;
+}
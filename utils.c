@@ -96,6 +96,25 @@ void free_input(InputData *data) {
     }
 }
 
+/**
+ * Count the number of different pages referenced in the trace
+ * With at least this many frames no algorithm ever evicts a page
+ */
+int count_distinct_pages(InputData *data) {
+    bool seen[MAX_PAGES] = { false };
+    int distinct = 0;
+    
+    for (int i = 0; i < data->count; i++) {
+        int page = data->references[i].page_number;
+        if (!seen[page]) {
+            seen[page] = true;
+            distinct++;
+        }
+    }
+    
+    return distinct;
+}
+
 /**
  * Print table header with algorithm name
  */
@@ -0,0 +1,379 @@
+#include "page_replacement.h"
+
+/**
+ * Complete all background cleanings that are in flight
+ * A cleaning finishes before the next fault's scan starts; pages that were
+ * written to again in the meantime had their cleaning cancelled. A cleaned
+ * page gets its skip budget back.
+ *
+ * @return Number of cleanings completed
+ */
+static int complete_cleanings(Frame *frames, bool *cleaning, int *skips, int num_frames) {
+    int completed = 0;
+    for (int j = 0; j < num_frames; j++) {
+        if (cleaning[j]) {
+            frames[j].dirty = 0;
+            cleaning[j] = false;
+            skips[j] = 0;
+            completed++;
+        }
+    }
+    return completed;
+}
+
+/**
+ * Simulate write-back-aware Second Chance (WSClock-style clean-first eviction)
+ *
+ * Same reference registers and clock hand as simulate_clock, but a dirty
+ * frame whose register is zero is not evicted straight away: it is scheduled
+ * for background cleaning and skipped, up to max_skips times. Once its skip
+ * budget is used up it is evicted with a synchronous write-back.
+ * A scan never skips more than one lap: if the hand gets back to the first
+ * frame it skipped, that frame is evicted synchronously.
+ * Background write-backs are counted when a cleaning completes, so a
+ * cleaning cancelled by a write or by eviction is never counted.
+ * With max_skips = 0 this behaves exactly like simulate_clock.
+ *
+ * @param data: Input data containing page references
+ * @param num_frames: Number of page frames available
+ * @param n_bits: Number of bits in the reference register (1-32)
+ * @param m_interval: Number of references between register shifts
+ * @param max_skips: Times a dirty frame may be skipped before eviction
+ * @param series: Optional per-window counters to fill (NULL to disable);
+ *                its write-backs are the synchronous ones
+ * @param trace: Optional event stream for faults and evictions (NULL to disable)
+ * @return WSClockResult with faults and synchronous/background write-backs
+ *         (extra_faults is filled in by the caller)
+ */
+WSClockResult simulate_wsclock(InputData *data, int num_frames, int n_bits, int m_interval,
+                               int max_skips, TimeSeries *series, EventTrace *trace) {
+    WSClockResult result;
+    result.frames = num_frames;
+    result.page_faults = 0;
+    result.sync_write_backs = 0;
+    result.background_write_backs = 0;
+    result.extra_faults = 0;
+
+    // Running totals in the form the time series expects
+    Result progress;
+    progress.frames = num_frames;
+    progress.page_faults = 0;
+    progress.write_backs = 0;
+
+    // Allocate frames and per-frame cleaning state
+    Frame *frames = (Frame*)malloc(num_frames * sizeof(Frame));
+    int *skips = (int*)calloc(num_frames, sizeof(int));
+    bool *cleaning = (bool*)calloc(num_frames, sizeof(bool));
+    if (!frames || !skips || !cleaning) {
+        fprintf(stderr, "Error: Memory allocation failed for frames\n");
+        exit(1);
+    }
+
+    // Initialize all frames to empty
+    initialize_frames(frames, num_frames);
+
+    int clock_hand = 0;  // Clock hand position (circular queue pointer)
+    int ref_counter = 0;  // Counter for reference register shifts
+    int pending = 0;  // Number of cleanings in flight
+
+    // Process each page reference
+    for (int i = 0; i < data->count; i++) {
+        int page = data->references[i].page_number;
+        int dirty = data->references[i].dirty;
+
+        // Close the current time-series window if one just ended
+        progress.page_faults = result.page_faults;
+        progress.write_backs = result.sync_write_backs;
+        timeseries_tick(series, i, &progress);
+
+        // Check if it's time to shift reference registers
+        if (ref_counter >= m_interval) {
+            for (int j = 0; j < num_frames; j++) {
+                if (frames[j].page_number != -1) {
+                    frames[j].ref_bits >>= 1;
+                }
+            }
+            ref_counter = 0;
+        }
+
+        // Check if page is already in frames (page hit)
+        int frame_idx = find_page_in_frames(frames, num_frames, page);
+
+        if (frame_idx != -1) {
+            // Page hit - set the high-order bit of the reference register
+            frames[frame_idx].ref_bits |= (1U << (n_bits - 1));
+
+            // A write during cleaning makes the page dirty again
+            if (dirty) {
+                frames[frame_idx].dirty = 1;
+                if (cleaning[frame_idx]) {
+                    cleaning[frame_idx] = false;  // Cancelled, not counted
+                    pending--;
+                }
+            }
+
+            ref_counter++;
+            continue;
+        }
+
+        // Page fault - page is not in memory
+        result.page_faults++;
+
+        // Cleanings scheduled during earlier faults have finished by now
+        if (pending > 0) {
+            result.background_write_backs += complete_cleanings(frames, cleaning, skips, num_frames);
+            pending = 0;
+        }
+
+        // Try to find an empty frame first
+        int victim_frame = find_empty_frame(frames, num_frames);
+
+        if (victim_frame == -1) {
+            // No empty frames - scan for a clean victim
+            int first_skipped = -1;  // First dirty frame skipped in this scan
+            while (1) {
+                if (clock_hand == first_skipped) {
+                    // Full lap without a clean victim: stop skipping
+                    victim_frame = clock_hand;
+                    clock_hand = (clock_hand + 1) % num_frames;
+                    break;
+                } else if (frames[clock_hand].ref_bits != 0) {
+                    // Recently used: give second chance
+                    frames[clock_hand].ref_bits >>= 1;
+                } else if (!frames[clock_hand].dirty) {
+                    // Clean and not recently used: evict without I/O
+                    victim_frame = clock_hand;
+                    clock_hand = (clock_hand + 1) % num_frames;
+                    break;
+                } else if (skips[clock_hand] < max_skips) {
+                    // Dirty: schedule background cleaning and skip it
+                    skips[clock_hand]++;
+                    if (!cleaning[clock_hand]) {
+                        cleaning[clock_hand] = true;
+                        pending++;
+                    }
+                    if (first_skipped == -1) {
+                        first_skipped = clock_hand;
+                    }
+                } else {
+                    // Dirty and out of skips: evict it anyway
+                    victim_frame = clock_hand;
+                    clock_hand = (clock_hand + 1) % num_frames;
+                    break;
+                }
+
+                // Move clock hand to next frame (circular)
+                clock_hand = (clock_hand + 1) % num_frames;
+            }
+
+            // A dirty victim is written back on the fault path. If its
+            // cleaning is still in flight, the fault waits for that write.
+            if (frames[victim_frame].dirty) {
+                result.sync_write_backs++;
+                if (cleaning[victim_frame]) {
+                    cleaning[victim_frame] = false;  // Cancelled, not counted
+                    pending--;
+                }
+            }
+        } else {
+            // Keep circular order for FIFO tie-breaking, as in simulate_clock
+            if (victim_frame == clock_hand) {
+                clock_hand = (clock_hand + 1) % num_frames;
+            }
+        }
+
+        // Record the fault and its victim (victim_page is -1 for an empty frame)
+        trace_event(trace, i, page, frames[victim_frame].page_number, victim_frame,
+                    frames[victim_frame].dirty);
+
+        // Load new page into the victim frame
+        frames[victim_frame].page_number = page;
+        frames[victim_frame].dirty = dirty;
+        frames[victim_frame].ref_bits = (1U << (n_bits - 1));
+        skips[victim_frame] = 0;
+
+        ref_counter++;
+    }
+
+    // Cleanings still in flight finish after the last reference
+    result.background_write_backs += complete_cleanings(frames, cleaning, skips, num_frames);
+
+    // Record the final (possibly partial) window
+    progress.page_faults = result.page_faults;
+    progress.write_backs = result.sync_write_backs;
+    timeseries_finish(series, data->count, &progress);
+
+    // Free allocated memory
+    free(frames);
+    free(skips);
+    free(cleaning);
+
+    return result;
+}
+
+/**
+ * Print table header for write-back-aware clock experiments
+ */
+static void print_wsclock_header(const char *title, const char *param_name) {
+    printf("\n%s\n", title);
+    printf("+----------+----------------+-----------------+-----------------+--------------+\n");
+    printf("| %-8s | %-14s | %-15s | %-15s | %-12s |\n",
+           param_name, "Page Faults", "Sync WB", "Background WB", "Extra Faults");
+    printf("+----------+----------------+-----------------+-----------------+--------------+\n");
+}
+
+/**
+ * Print a single row in the write-back-aware clock table
+ */
+static void print_wsclock_row(int param, const WSClockResult *result) {
+    printf("| %-8d | %-14d | %-15d | %-15d | %-12d |\n", param, result->page_faults,
+           result->sync_write_backs, result->background_write_backs, result->extra_faults);
+    printf("+----------+----------------+-----------------+-----------------+--------------+\n");
+}
+
+/**
+ * Save write-back-aware clock results to CSV file for plotting
+ */
+static void save_wsclock_results_to_csv(const char *filename, WSClockResult *results,
+                                        int count, const char *param_name) {
+    char filepath[512];
+    snprintf(filepath, sizeof(filepath), "results/data/%s", filename);
+
+    FILE *fp = fopen(filepath, "w");
+    if (!fp) {
+        fprintf(stderr, "Warning: Could not open %s for writing\n", filepath);
+        return;
+    }
+
+    fprintf(fp, "%s,PageFaults,SyncWriteBack,BackgroundWriteBack,ExtraFaults\n", param_name);
+    for (int i = 0; i < count; i++) {
+        fprintf(fp, "%d,%d,%d,%d,%d\n",
+                results[i].frames,
+                results[i].page_faults,
+                results[i].sync_write_backs,
+                results[i].background_write_backs,
+                results[i].extra_faults);
+    }
+
+    fclose(fp);
+}
+
+/**
+ * Run one write-back-aware clock configuration and compare it with plain
+ * CLK (served from the result cache when possible)
+ */
+static WSClockResult run_wsclock_config(InputData *data, RunOptions *options, int frames,
+                                        int n_bits, int m_interval, TimeSeries *series) {
+    if (series) {
+        timeseries_reset(series);
+    }
+    trace_begin_run(options->trace, ALG_WSCLK, frames, n_bits, m_interval);
+    trace_run_options(options->trace, options->max_skips, 0);
+    WSClockResult result = simulate_wsclock(data, frames, n_bits, m_interval,
+                                            options->max_skips, series, options->trace);
+
+    Result baseline;
+    if (!cache_lookup(options->cache, ALG_CLK, frames, n_bits, m_interval, &baseline)) {
+        baseline = simulate_clock(data, frames, n_bits, m_interval, NULL, NULL);
+        cache_store(options->cache, ALG_CLK, frames, n_bits, m_interval, &baseline);
+    }
+    result.extra_faults = result.page_faults - baseline.page_faults;
+
+    return result;
+}
+
+/**
+ * Run write-back-aware Second Chance experiments
+ * Same sweeps as run_clock_experiments, so the tables line up with CLK:
+ * 1. Fix m=10, vary n from 1 to 32 with 50 frames
+ * 2. Fix n=8, vary m from 1 to 100 with 50 frames
+ */
+void run_wsclock_experiments(InputData *data, RunOptions *options) {
+    const int FRAMES = 50;
+
+    // Optional time series, reused across all runs
+    TimeSeries *series = NULL;
+    if (options->window > 0) {
+        series = timeseries_create(options->window, data->count);
+    }
+
+    // Experiment 1: Fix m=10, vary n from 1 to 32
+    {
+        const int M_FIXED = 10;
+        const int MIN_N = 1;
+        const int MAX_N = 32;
+        int num_experiments = MAX_N - MIN_N + 1;
+
+        WSClockResult *results = (WSClockResult*)malloc(num_experiments * sizeof(WSClockResult));
+        if (!results) {
+            fprintf(stderr, "Error: Memory allocation failed for results\n");
+            exit(1);
+        }
+
+        FILE *series_fp = series ? timeseries_open_csv("wsclock_vary_n_timeseries.csv", "n") : NULL;
+
+        char title[64];
+        snprintf(title, sizeof(title), "WSCLK, m=%d, skips=%d", M_FIXED, options->max_skips);
+        print_wsclock_header(title, "n");
+
+        for (int n = MIN_N; n <= MAX_N; n++) {
+            WSClockResult result = run_wsclock_config(data, options, FRAMES, n, M_FIXED, series);
+            result.frames = n;  // Store n value for CSV
+            results[n - MIN_N] = result;
+
+            if (series) {
+                timeseries_write_csv(series_fp, n, series);
+            }
+
+            print_wsclock_row(n, &result);
+        }
+
+        save_wsclock_results_to_csv("wsclock_vary_n.csv", results, num_experiments, "n");
+
+        if (series_fp) {
+            fclose(series_fp);
+        }
+        free(results);
+    }
+
+    // Experiment 2: Fix n=8, vary m from 1 to 100
+    {
+        const int N_FIXED = 8;
+        const int MIN_M = 1;
+        const int MAX_M = 100;
+        int num_experiments = MAX_M - MIN_M + 1;
+
+        WSClockResult *results = (WSClockResult*)malloc(num_experiments * sizeof(WSClockResult));
+        if (!results) {
+            fprintf(stderr, "Error: Memory allocation failed for results\n");
+            exit(1);
+        }
+
+        FILE *series_fp = series ? timeseries_open_csv("wsclock_vary_m_timeseries.csv", "m") : NULL;
+
+        char title[64];
+        snprintf(title, sizeof(title), "WSCLK, n=%d, skips=%d", N_FIXED, options->max_skips);
+        print_wsclock_header(title, "m");
+
+        for (int m = MIN_M; m <= MAX_M; m++) {
+            WSClockResult result = run_wsclock_config(data, options, FRAMES, N_FIXED, m, series);
+            result.frames = m;  // Store m value for CSV
+            results[m - MIN_M] = result;
+
+            if (series) {
+                timeseries_write_csv(series_fp, m, series);
+            }
+
+            print_wsclock_row(m, &result);
+        }
+
+        save_wsclock_results_to_csv("wsclock_vary_m.csv", results, num_experiments, "m");
+
+        if (series_fp) {
+            fclose(series_fp);
+        }
+        free(results);
+    }
+
+    timeseries_free(series);
+}